@@ -69,6 +69,7 @@ class NumberObject;
 class Object;
 class ObjectOperationDescriptor;
 class ObjectTemplate;
+class OutputStream;
 class Platform;
 class Primitive;
 class Promise;
@@ -140,6 +141,7 @@ class Heap;
 class HeapObject;
 class ExternalString;
 class Isolate;
+class JsonParseTask;
 class LocalEmbedderHeapTracer;
 class MicrotaskQueue;
 class PropertyCallbackArguments;
@@ -2424,6 +2426,51 @@ class V8_EXPORT JSON {
   static V8_WARN_UNUSED_RESULT MaybeLocal<Value> Parse(
       Local<Context> context, Local<String> json_string);
 
+  /**
+   * A task which parses a JSON string on a background thread. Returned by
+   * JSON::StartParse.
+   */
+  class V8_EXPORT ParseTask final {
+   public:
+    ~ParseTask();
+    ParseTask(const ParseTask&) = delete;
+    ParseTask& operator=(const ParseTask&) = delete;
+
+    /**
+     * Scans the string and allocates its strings and numbers. May be called
+     * on any thread, but only once. When called on the isolate's thread, it
+     * does nothing, and JSON::FinishParse parses the whole string instead.
+     */
+    void Run();
+
+   private:
+    friend class JSON;
+
+    explicit ParseTask(std::unique_ptr<internal::JsonParseTask> impl);
+
+    std::unique_ptr<internal::JsonParseTask> impl_;
+  };
+
+  /**
+   * Prepares to parse |json_string| off the main thread, for large strings
+   * whose parsing would otherwise block the main thread for a long time. The
+   * embedder runs the returned task on a background thread, and afterwards
+   * calls JSON::FinishParse on the isolate's thread.
+   *
+   * The contents of the string are copied, so the string may be modified or
+   * collected while the task runs.
+   */
+  static std::unique_ptr<ParseTask> StartParse(Isolate* isolate,
+                                               Local<String> json_string);
+
+  /**
+   * Creates the objects and arrays of a JSON string parsed by |task|, which
+   * must have been run. Returns the same value, or throws the same
+   * exception, as JSON::Parse would have.
+   */
+  static V8_WARN_UNUSED_RESULT MaybeLocal<Value> FinishParse(
+      Local<Context> context, std::unique_ptr<ParseTask> task);
+
   /**
    * Tries to stringify the JSON-serializable object |json_object| and returns
    * it as string if successful.
@@ -2434,6 +2481,28 @@ class V8_EXPORT JSON {
   static V8_WARN_UNUSED_RESULT MaybeLocal<String> Stringify(
       Local<Context> context, Local<Value> json_object,
       Local<String> gap = Local<String>());
+
+  /**
+   * Like JSON::Stringify, but writes the result to |stream| as UTF-8 while
+   * serializing, instead of building a string, so that large values can be
+   * serialized with bounded memory.
+   *
+   * The output is passed to OutputStream::WriteAsciiChunk in chunks of
+   * OutputStream::GetChunkSize() bytes (the last one may be shorter), and
+   * OutputStream::EndOfStream is called once all of it has been written.
+   * The stream can apply backpressure by blocking in WriteAsciiChunk, or stop
+   * serialization by returning kAbort. WriteAsciiChunk is called while garbage
+   * collection is disallowed, so it must not call back into V8, e.g. to
+   * allocate handles or run JavaScript. Lone surrogates in |gap| have no UTF-8
+   * encoding and are written as U+FFFD.
+   *
+   * \return true if the whole result has been written, false if |json_object|
+   * has no JSON representation (e.g. undefined) or the stream aborted, and
+   * nothing if an exception was thrown.
+   */
+  static V8_WARN_UNUSED_RESULT Maybe<bool> StringifyToStream(
+      Local<Context> context, Local<Value> json_object, OutputStream* stream,
+      Local<String> gap = Local<String>());
 };
 
 /**
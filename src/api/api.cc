@@ -3225,6 +3225,32 @@ MaybeLocal<Value> JSON::Parse(Local<Context> context,
   RETURN_ESCAPED(result);
 }
 
+JSON::ParseTask::ParseTask(std::unique_ptr<i::JsonParseTask> impl)
+    : impl_(std::move(impl)) {}
+
+JSON::ParseTask::~ParseTask() = default;
+
+void JSON::ParseTask::Run() { impl_->Run(); }
+
+std::unique_ptr<JSON::ParseTask> JSON::StartParse(Isolate* v8_isolate,
+                                                  Local<String> json_string) {
+  i::Isolate* isolate = reinterpret_cast<i::Isolate*>(v8_isolate);
+  ENTER_V8_NO_SCRIPT_NO_EXCEPTION(isolate);
+  return std::unique_ptr<ParseTask>(new ParseTask(
+      std::make_unique<i::JsonParseTask>(isolate,
+                                         Utils::OpenHandle(*json_string))));
+}
+
+MaybeLocal<Value> JSON::FinishParse(Local<Context> context,
+                                    std::unique_ptr<ParseTask> task) {
+  PREPARE_FOR_EXECUTION(context, JSON, FinishParse, Value);
+  Local<Value> result;
+  has_pending_exception =
+      !ToLocal<Value>(task->impl_->Finalize(isolate), &result);
+  RETURN_ON_FAILED_EXECUTION(Value);
+  RETURN_ESCAPED(result);
+}
+
 MaybeLocal<String> JSON::Stringify(Local<Context> context,
                                    Local<Value> json_object,
                                    Local<String> gap) {
@@ -3245,6 +3271,23 @@ MaybeLocal<String> JSON::Stringify(Local<Context> context,
   RETURN_ESCAPED(result);
 }
 
+Maybe<bool> JSON::StringifyToStream(Local<Context> context,
+                                    Local<Value> json_object,
+                                    OutputStream* stream, Local<String> gap) {
+  auto isolate = reinterpret_cast<i::Isolate*>(context->GetIsolate());
+  ENTER_V8(isolate, context, JSON, StringifyToStream, Nothing<bool>(),
+           i::HandleScope);
+  i::Handle<i::Object> object = Utils::OpenHandle(*json_object);
+  i::Handle<i::Object> gap_string = gap.IsEmpty()
+                                        ? isolate->factory()->empty_string()
+                                        : Utils::OpenHandle(*gap);
+  Maybe<bool> result =
+      i::JsonStringifyToStream(isolate, object, gap_string, stream);
+  has_pending_exception = result.IsNothing();
+  RETURN_ON_FAILED_EXECUTION_PRIMITIVE(bool);
+  return result;
+}
+
 // --- V a l u e   S e r i a l i z a t i o n ---
 
 Maybe<bool> ValueSerializer::Delegate::WriteHostObject(Isolate* v8_isolate,
@@ -8790,7 +8833,9 @@ void Isolate::GetHeapStatistics(HeapStatistics* heap_statistics) {
   // now we just add the values, thereby over-approximating the peak slightly.
   heap_statistics->malloced_memory_ =
       isolate->allocator()->GetCurrentMemoryUsage() +
+      isolate->allocator()->GetCurrentPoolSize() +
       isolate->wasm_engine()->allocator()->GetCurrentMemoryUsage() +
+      isolate->wasm_engine()->allocator()->GetCurrentPoolSize() +
       isolate->string_table()->GetCurrentMemoryUsage();
   heap_statistics->external_memory_ = isolate->heap()->backing_store_bytes();
   heap_statistics->peak_malloced_memory_ =
@@ -9100,6 +9145,8 @@ void Isolate::LowMemoryNotification() {
     isolate->heap()->CollectAllAvailableGarbage(
         i::GarbageCollectionReason::kLowMemoryNotification);
   }
+  isolate->allocator()->ReleasePooledSegments();
+  isolate->wasm_engine()->allocator()->ReleasePooledSegments();
 }
 
 int Isolate::ContextDisposedNotification(bool dependant_context) {
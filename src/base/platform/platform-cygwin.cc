@@ -199,6 +199,14 @@ bool OS::DiscardSystemPages(void* address, size_t size) {
   return ptr;
 }
 
+// static
+bool OS::AdviseHugePages(void* address, size_t size) {
+  // Memory is reserved with VirtualAlloc on Cygwin, whose large pages need to
+  // be committed up front. That doesn't fit reservations that are committed
+  // incrementally.
+  return false;
+}
+
 // static
 bool OS::HasLazyCommits() {
   // TODO(alph): implement for the platform.
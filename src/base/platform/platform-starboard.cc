@@ -495,5 +495,8 @@ bool OS::DiscardSystemPages(void* address, size_t size) {
   return true;
 }
 
+// static
+bool OS::AdviseHugePages(void* address, size_t size) { return false; }
+
 }  // namespace base
 }  // namespace v8
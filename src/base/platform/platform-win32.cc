@@ -907,6 +907,13 @@ bool OS::DiscardSystemPages(void* address, size_t size) {
   return ptr;
 }
 
+// static
+bool OS::AdviseHugePages(void* address, size_t size) {
+  // Large pages need to be committed up front on Windows, which doesn't fit
+  // reservations that are committed incrementally.
+  return false;
+}
+
 // static
 bool OS::HasLazyCommits() {
   // TODO(alph): implement for the platform.
@@ -515,6 +515,36 @@ TNode<HeapObject> RegExpBuiltinsAssembler::RegExpExecInternal(
   GotoIf(TaggedIsSmi(var_code.value()), &runtime);
   TNode<Code> code = CAST(var_code.value());
 
+  // Long subjects of regexps with a literal prefix are first searched for that
+  // prefix by the runtime, which can then skip the matcher entirely. Only the
+  // first exec on a subject takes this detour; the following ones of a global
+  // loop would otherwise pay for a runtime call per match.
+  {
+    Label next(this);
+    TNode<Object> prefilter =
+        UnsafeLoadFixedArrayElement(data, JSRegExp::kIrregexpPrefilterIndex);
+    GotoIf(TaggedIsSmi(prefilter), &next);
+    GotoIfNot(IntPtrEqual(int_last_index, IntPtrConstant(0)), &next);
+    Branch(IntPtrLessThan(
+               int_string_length,
+               IntPtrConstant(JSRegExp::kPrefilterForSubjectLengthValue)),
+           &next, &runtime);
+    BIND(&next);
+  }
+
+  // Keep the native code budget, if there is one, from treating this regexp
+  // as cold.
+  {
+    Label next(this);
+    TNode<UintPtrT> budget = Load<UintPtrT>(ExternalConstant(
+        ExternalReference::address_of_regexp_native_code_budget()));
+    GotoIf(WordEqual(budget, UintPtrConstant(0)), &next);
+    UnsafeStoreFixedArrayElement(data, JSRegExp::kIrregexpRecentlyUsedIndex,
+                                 SmiConstant(1));
+    Goto(&next);
+    BIND(&next);
+  }
+
   Label if_success(this), if_exception(this, Label::kDeferred);
   {
     IncrementCounter(isolate()->counters()->regexp_entry_native(), 1);
@@ -485,6 +485,10 @@ ExternalReference::address_of_enable_experimental_regexp_engine() {
   return ExternalReference(&FLAG_enable_experimental_regexp_engine);
 }
 
+ExternalReference ExternalReference::address_of_regexp_native_code_budget() {
+  return ExternalReference(&FLAG_regexp_native_code_budget);
+}
+
 ExternalReference ExternalReference::is_profiling_address(Isolate* isolate) {
   return ExternalReference(isolate->is_profiling_address());
 }
@@ -19,12 +19,15 @@
 #include "src/codegen/interface-descriptors.h"
 #include "src/codegen/machine-type.h"
 #include "src/codegen/optimized-compilation-info.h"
+#include "src/codegen/tick-counter.h"
 #include "src/compiler/backend/code-generator.h"
 #include "src/compiler/backend/instruction-selector.h"
 #include "src/compiler/common-operator.h"
 #include "src/compiler/compiler-source-position-table.h"
 #include "src/compiler/diamond.h"
 #include "src/compiler/graph-assembler.h"
+#include "src/compiler/graph-reducer.h"
+#include "src/compiler/graph-trimmer.h"
 #include "src/compiler/graph-visualizer.h"
 #include "src/compiler/graph.h"
 #include "src/compiler/int64-lowering.h"
@@ -35,6 +38,7 @@
 #include "src/compiler/node-properties.h"
 #include "src/compiler/pipeline.h"
 #include "src/compiler/simd-scalar-lowering.h"
+#include "src/compiler/wasm-inlining.h"
 #include "src/compiler/zone-stats.h"
 #include "src/execution/isolate-inl.h"
 #include "src/heap/factory.h"
@@ -2962,9 +2966,10 @@ Node* WasmGraphBuilder::CallDirect(uint32_t index, Vector<Node*> args,
 
 Node* WasmGraphBuilder::CallIndirect(uint32_t table_index, uint32_t sig_index,
                                      Vector<Node*> args, Vector<Node*> rets,
-                                     wasm::WasmCodePosition position) {
+                                     wasm::WasmCodePosition position,
+                                     bool inside_try_scope) {
   return BuildIndirectCall(table_index, sig_index, args, rets, position,
-                           kCallContinues);
+                           kCallContinues, inside_try_scope);
 }
 
 void WasmGraphBuilder::LoadIndirectFunctionTable(uint32_t table_index,
@@ -3010,7 +3015,8 @@ Node* WasmGraphBuilder::BuildIndirectCall(uint32_t table_index,
                                           Vector<Node*> args,
                                           Vector<Node*> rets,
                                           wasm::WasmCodePosition position,
-                                          IsReturnCall continuation) {
+                                          IsReturnCall continuation,
+                                          bool inside_try_scope) {
   DCHECK_NOT_NULL(args[0]);
   DCHECK_NOT_NULL(env_);
 
@@ -3086,6 +3092,21 @@ Node* WasmGraphBuilder::BuildIndirectCall(uint32_t table_index,
   const UseRetpoline use_retpoline =
       untrusted_code_mitigations_ ? kRetpoline : kNoRetpoline;
 
+  // The speculative call splits control flow, which would confuse the
+  // exception edges attached to calls inside of try blocks.
+  if (FLAG_wasm_speculative_call_indirect && continuation == kCallContinues &&
+      table_index == 0 && !inside_try_scope) {
+    const std::vector<int32_t>& predictions =
+        env_->module->speculative_call_indirect_targets;
+    uint32_t sig_id = env_->module->canonicalized_type_ids[sig_index];
+    if (sig_id < predictions.size() &&
+        predictions[sig_id] != wasm::WasmModule::kNoSpeculativeTarget) {
+      return BuildSpeculativeIndirectCall(
+          sig, args, rets, position, target, target_instance,
+          static_cast<uint32_t>(predictions[sig_id]), use_retpoline);
+    }
+  }
+
   switch (continuation) {
     case kCallContinues:
       return BuildWasmCall(sig, args, rets, position, target_instance,
@@ -3096,6 +3117,58 @@ Node* WasmGraphBuilder::BuildIndirectCall(uint32_t table_index,
   }
 }
 
+Node* WasmGraphBuilder::BuildSpeculativeIndirectCall(
+    const wasm::FunctionSig* sig, Vector<Node*> args, Vector<Node*> rets,
+    wasm::WasmCodePosition position, Node* target, Node* target_instance,
+    uint32_t predicted_index, UseRetpoline use_retpoline) {
+  DCHECK_GE(predicted_index, env_->module->num_imported_functions);
+  DCHECK_EQ(args[0], target);
+
+  // Table entries of declared functions point into the jump table of their
+  // native module, which all instances of this module share. If the entry is
+  // the jump table slot of {predicted_index}, the callee is that function,
+  // running in {target_instance}.
+  Node* jump_table_start =
+      LOAD_INSTANCE_FIELD(JumpTableStart, MachineType::Pointer());
+  Node* predicted_target = gasm_->IntAdd(
+      jump_table_start,
+      gasm_->IntPtrConstant(wasm::JumpTableAssembler::JumpSlotIndexToOffset(
+          wasm::declared_function_index(env_->module, predicted_index))));
+
+  Node* if_predicted;
+  Node* if_not_predicted;
+  BranchNoHint(gasm_->WordEqual(target, predicted_target), &if_predicted,
+               &if_not_predicted);
+  Node* effect_before_call = effect();
+
+  // Direct call to the predicted function.
+  SetControl(if_predicted);
+  size_t ret_count = sig->return_count();
+  base::SmallVector<Node*, 1> direct_rets(ret_count);
+  args[0] = mcgraph()->RelocatableIntPtrConstant(
+      static_cast<Address>(predicted_index), RelocInfo::WASM_CALL);
+  BuildWasmCall(sig, args, VectorOf(direct_rets), position, target_instance,
+                kNoRetpoline);
+  Node* direct_effect = effect();
+  Node* direct_control = control();
+
+  // Generic indirect call.
+  SetEffectControl(effect_before_call, if_not_predicted);
+  args[0] = target;
+  Node* call = BuildWasmCall(sig, args, rets, position, target_instance,
+                             use_retpoline);
+
+  Node* controls[] = {direct_control, control()};
+  Node* merge = Merge(2, controls);
+  Node* effects[] = {direct_effect, effect(), merge};
+  SetEffectControl(EffectPhi(2, effects), merge);
+  for (size_t i = 0; i < ret_count; i++) {
+    Node* values[] = {direct_rets[i], rets[i], merge};
+    rets[i] = Phi(sig->GetReturn(i), 2, values);
+  }
+  return call;
+}
+
 Node* WasmGraphBuilder::BuildLoadJumpTableOffsetFromExportedFunctionData(
     Node* function_data) {
   Node* jump_table_offset_smi =
@@ -3265,7 +3338,7 @@ Node* WasmGraphBuilder::ReturnCallIndirect(uint32_t table_index,
                                            Vector<Node*> args,
                                            wasm::WasmCodePosition position) {
   return BuildIndirectCall(table_index, sig_index, args, {}, position,
-                           kReturnCall);
+                           kReturnCall, false);
 }
 
 Node* WasmGraphBuilder::BrOnNull(Node* ref_object, Node** null_node,
@@ -7804,7 +7877,9 @@ namespace {
 bool BuildGraphForWasmFunction(AccountingAllocator* allocator,
                                wasm::CompilationEnv* env,
                                const wasm::FunctionBody& func_body,
-                               int func_index, wasm::WasmFeatures* detected,
+                               int func_index,
+                               const wasm::WireBytesStorage* wire_bytes,
+                               wasm::WasmFeatures* detected,
                                MachineGraph* mcgraph,
                                NodeOriginTable* node_origins,
                                SourcePositionTable* source_positions) {
@@ -7823,6 +7898,24 @@ bool BuildGraphForWasmFunction(AccountingAllocator* allocator,
     return false;
   }
 
+  // Inline small direct callees before lowering, so that their nodes are
+  // lowered together with the ones of the caller. Asm.js functions are not
+  // inlined, since their source positions map to JavaScript code.
+  if (FLAG_wasm_inlining && wire_bytes != nullptr &&
+      !is_asmjs_module(env->module)) {
+    Zone inlining_zone(allocator, ZONE_NAME);
+    TickCounter tick_counter;
+    GraphReducer graph_reducer(&inlining_zone, mcgraph->graph(), &tick_counter,
+                               nullptr, mcgraph->Dead());
+    WasmInliner inliner(&graph_reducer, env, source_positions, node_origins,
+                        mcgraph, wire_bytes, func_index, detected);
+    graph_reducer.AddReducer(&inliner);
+    graph_reducer.ReduceGraph();
+    // Remove uses from abandoned inlinee graphs and killed nodes.
+    GraphTrimmer trimmer(&inlining_zone, mcgraph->graph());
+    trimmer.TrimGraph();
+  }
+
   // Lower SIMD first, i64x2 nodes will be lowered to int64 nodes, then int64
   // lowering will take care of them.
   auto sig = CreateMachineSignature(mcgraph->zone(), func_body.sig,
@@ -7891,7 +7984,8 @@ Vector<const char> GetDebugName(Zone* zone, int index) {
 
 wasm::WasmCompilationResult ExecuteTurbofanWasmCompilation(
     wasm::WasmEngine* wasm_engine, wasm::CompilationEnv* env,
-    const wasm::FunctionBody& func_body, int func_index, Counters* counters,
+    const wasm::FunctionBody& func_body, int func_index,
+    const wasm::WireBytesStorage* wire_bytes, Counters* counters,
     wasm::WasmFeatures* detected) {
   TRACE_EVENT2(TRACE_DISABLED_BY_DEFAULT("v8.wasm.detailed"),
                "wasm.CompileTopTier", "func_index", func_index, "body_size",
@@ -7921,8 +8015,8 @@ wasm::WasmCompilationResult ExecuteTurbofanWasmCompilation(
   SourcePositionTable* source_positions =
       mcgraph->zone()->New<SourcePositionTable>(mcgraph->graph());
   if (!BuildGraphForWasmFunction(wasm_engine->allocator(), env, func_body,
-                                 func_index, detected, mcgraph, node_origins,
-                                 source_positions)) {
+                                 func_index, wire_bytes, detected, mcgraph,
+                                 node_origins, source_positions)) {
     return wasm::WasmCompilationResult{};
   }
 
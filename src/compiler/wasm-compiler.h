@@ -50,9 +50,10 @@ enum class LoadTransformationKind : uint8_t;
 
 namespace compiler {
 
-wasm::WasmCompilationResult ExecuteTurbofanWasmCompilation(
+V8_EXPORT_PRIVATE wasm::WasmCompilationResult ExecuteTurbofanWasmCompilation(
     wasm::WasmEngine*, wasm::CompilationEnv*, const wasm::FunctionBody&,
-    int func_index, Counters*, wasm::WasmFeatures* detected);
+    int func_index, const wasm::WireBytesStorage* wire_bytes, Counters*,
+    wasm::WasmFeatures* detected);
 
 // Calls to Wasm imports are handled in several different ways, depending on the
 // type of the target function/callable and whether the signature matches the
@@ -270,9 +271,11 @@ class WasmGraphBuilder {
 
   Node* CallDirect(uint32_t index, Vector<Node*> args, Vector<Node*> rets,
                    wasm::WasmCodePosition position);
+  // {inside_try_scope} is true if exceptions thrown by the call are caught
+  // by an enclosing try block of the function.
   Node* CallIndirect(uint32_t table_index, uint32_t sig_index,
                      Vector<Node*> args, Vector<Node*> rets,
-                     wasm::WasmCodePosition position);
+                     wasm::WasmCodePosition position, bool inside_try_scope);
   Node* CallRef(uint32_t sig_index, Vector<Node*> args, Vector<Node*> rets,
                 CheckForNull null_check, wasm::WasmCodePosition position);
 
@@ -495,7 +498,16 @@ class WasmGraphBuilder {
   Node* BuildIndirectCall(uint32_t table_index, uint32_t sig_index,
                           Vector<Node*> args, Vector<Node*> rets,
                           wasm::WasmCodePosition position,
-                          IsReturnCall continuation);
+                          IsReturnCall continuation,
+                          bool inside_try_scope);
+  // Helper function for {BuildIndirectCall}: guards a direct call to
+  // {predicted_index} with a comparison against the loaded table {target}.
+  Node* BuildSpeculativeIndirectCall(const wasm::FunctionSig* sig,
+                                     Vector<Node*> args, Vector<Node*> rets,
+                                     wasm::WasmCodePosition position,
+                                     Node* target, Node* target_instance,
+                                     uint32_t predicted_index,
+                                     UseRetpoline use_retpoline);
   Node* BuildWasmCall(const wasm::FunctionSig* sig, Vector<Node*> args,
                       Vector<Node*> rets, wasm::WasmCodePosition position,
                       Node* instance_node, UseRetpoline use_retpoline);
@@ -0,0 +1,272 @@
+// Copyright 2021 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/compiler/wasm-inlining.h"
+
+#include "src/compiler/compiler-source-position-table.h"
+#include "src/compiler/node-matchers.h"
+#include "src/compiler/node-properties.h"
+#include "src/compiler/wasm-compiler.h"
+#include "src/wasm/graph-builder-interface.h"
+#include "src/wasm/wasm-features.h"
+#include "src/wasm/wasm-module.h"
+
+namespace v8 {
+namespace internal {
+namespace compiler {
+
+#define TRACE(...)                                     \
+  do {                                                 \
+    if (FLAG_trace_wasm_inlining) PrintF(__VA_ARGS__); \
+  } while (false)
+
+WasmInliner::WasmInliner(Editor* editor, wasm::CompilationEnv* env,
+                         SourcePositionTable* source_positions,
+                         NodeOriginTable* node_origins, MachineGraph* mcgraph,
+                         const wasm::WireBytesStorage* wire_bytes,
+                         uint32_t function_index,
+                         wasm::WasmFeatures* detected)
+    : AdvancedReducer(editor),
+      env_(env),
+      source_positions_(source_positions),
+      node_origins_(node_origins),
+      mcgraph_(mcgraph),
+      wire_bytes_(wire_bytes),
+      function_index_(function_index),
+      detected_(detected),
+      remaining_budget_(FLAG_wasm_inlining_budget) {}
+
+const wasm::WasmModule* WasmInliner::module() const { return env_->module; }
+
+Reduction WasmInliner::Reduce(Node* node) {
+  if (node->opcode() == IrOpcode::kCall) return ReduceCall(node);
+  return NoChange();
+}
+
+int WasmInliner::GetDirectCallee(Node* call) const {
+  Node* callee = NodeProperties::GetValueInput(call, 0);
+  IrOpcode::Value reloc_opcode = mcgraph()->machine()->Is32()
+                                     ? IrOpcode::kRelocatableInt32Constant
+                                     : IrOpcode::kRelocatableInt64Constant;
+  if (callee->opcode() != reloc_opcode) return -1;
+  const RelocatablePtrConstantInfo& info =
+      OpParameter<RelocatablePtrConstantInfo>(callee->op());
+  if (info.rmode() != RelocInfo::WASM_CALL) return -1;
+  return static_cast<int>(info.value());
+}
+
+bool WasmInliner::IsInlineable(Node* call, uint32_t callee_index) const {
+  if (callee_index == function_index_) return false;
+  if (callee_index < module()->num_imported_functions) return false;
+  const wasm::WasmFunction& callee = module()->functions[callee_index];
+  size_t body_size = callee.code.length();
+  if (body_size > static_cast<size_t>(FLAG_wasm_inlining_max_size)) {
+    return false;
+  }
+  if (body_size > remaining_budget_) return false;
+  // Exceptional control flow out of the inlinee is not supported.
+  for (Node* use : call->uses()) {
+    if (use->opcode() == IrOpcode::kIfException) return false;
+  }
+  return true;
+}
+
+Reduction WasmInliner::ReduceCall(Node* call) {
+  int callee_index = GetDirectCallee(call);
+  if (callee_index < 0) return NoChange();
+  if (!IsInlineable(call, static_cast<uint32_t>(callee_index))) {
+    return NoChange();
+  }
+
+  const wasm::WasmFunction& callee = module()->functions[callee_index];
+  Vector<const byte> function_bytes = wire_bytes_->GetCode(callee.code);
+  const wasm::FunctionBody callee_body(callee.sig, callee.code.offset(),
+                                       function_bytes.begin(),
+                                       function_bytes.end());
+  WasmGraphBuilder builder(env_, zone(), mcgraph(), callee.sig,
+                           source_positions_);
+  NodeId first_inlinee_node = static_cast<NodeId>(graph()->NodeCount());
+  wasm::VoidResult result;
+  Node* callee_start;
+  Node* callee_end;
+  {
+    Graph::SubgraphScope scope(graph());
+    // The builder creates a fresh end node on demand.
+    graph()->SetEnd(nullptr);
+    result = wasm::BuildTFGraph(zone()->allocator(), env_->enabled_features,
+                                module(), &builder, detected_, callee_body,
+                                node_origins_);
+    callee_start = graph()->start();
+    callee_end = graph()->end();
+  }
+  // Abandoned subgraphs are not reachable from the end of the caller graph,
+  // and get trimmed away after inlining.
+  if (result.failed() || callee_end == nullptr) return NoChange();
+  if (builder.has_simd() &&
+      (!CpuFeatures::SupportsWasmSimd128() || env_->lower_simd)) {
+    // SIMD lowering is only triggered by the caller's own graph builder.
+    return NoChange();
+  }
+  // A tail call in the inlinee would return from the caller, skipping the
+  // rest of it.
+  for (Node* const input : callee_end->inputs()) {
+    if (input->opcode() == IrOpcode::kTailCall) {
+      TRACE("[function %u: not inlining function %d, it has tail calls]\n",
+            function_index_, callee_index);
+      return NoChange();
+    }
+  }
+
+  TRACE("[function %u: inlining call to function %d (%zu bytes)]\n",
+        function_index_, callee_index, callee.code.length());
+  remaining_budget_ -= callee.code.length();
+  SetInlineeSourcePositions(call, callee_end, first_inlinee_node);
+  return InlineCall(call, callee_start, callee_end, callee.sig);
+}
+
+void WasmInliner::RewireFunctionEntry(Node* call, Node* callee_start) {
+  Node* control = NodeProperties::GetControlInput(call);
+  Node* effect = NodeProperties::GetEffectInput(call);
+
+  for (Edge edge : callee_start->use_edges()) {
+    Node* use = edge.from();
+    if (use->opcode() == IrOpcode::kParameter) {
+      // Parameter 0 is the instance, which is input 1 of the call; input 0
+      // is the call target.
+      int index = 1 + ParameterIndexOf(use->op());
+      Replace(use, NodeProperties::GetValueInput(call, index));
+    } else if (NodeProperties::IsEffectEdge(edge)) {
+      edge.UpdateTo(effect);
+    } else {
+      DCHECK(NodeProperties::IsControlEdge(edge));
+      edge.UpdateTo(control);
+    }
+  }
+}
+
+void WasmInliner::SetInlineeSourcePositions(Node* call, Node* callee_end,
+                                            NodeId first_inlinee_node) {
+  // Positions within the inlinee are relative to its own body. Attribute all
+  // of them to the call site, so that traps and stack traces point there.
+  SourcePosition call_position = source_positions_->GetSourcePosition(call);
+  // Node marks are in use by the graph reducer, so track visited nodes by id.
+  ZoneVector<bool> visited(graph()->NodeCount() - first_inlinee_node, false,
+                           zone());
+  ZoneVector<Node*> worklist(zone());
+  worklist.push_back(callee_end);
+  visited[callee_end->id() - first_inlinee_node] = true;
+  while (!worklist.empty()) {
+    Node* node = worklist.back();
+    worklist.pop_back();
+    if (source_positions_->GetSourcePosition(node).IsKnown()) {
+      source_positions_->SetSourcePosition(node, call_position);
+    }
+    for (Node* input : node->inputs()) {
+      if (input->id() < first_inlinee_node) continue;
+      if (visited[input->id() - first_inlinee_node]) continue;
+      visited[input->id() - first_inlinee_node] = true;
+      worklist.push_back(input);
+    }
+  }
+}
+
+Reduction WasmInliner::InlineCall(Node* call, Node* callee_start,
+                                  Node* callee_end,
+                                  const wasm::FunctionSig* callee_sig) {
+  DCHECK_EQ(IrOpcode::kCall, call->opcode());
+
+  // 1) Rewire function entry.
+  RewireFunctionEntry(call, callee_start);
+
+  // 2) Handle all graph terminators of the inlinee.
+  const int return_arity = static_cast<int>(callee_sig->return_count());
+  NodeVector return_nodes(zone());
+  for (Node* const input : callee_end->inputs()) {
+    DCHECK(IrOpcode::IsGraphTerminator(input->opcode()));
+    DCHECK_NE(IrOpcode::kTailCall, input->opcode());
+    if (input->opcode() == IrOpcode::kReturn &&
+        input->op()->ValueInputCount() == return_arity + 1) {
+      return_nodes.push_back(input);
+      continue;
+    }
+    if (input->opcode() == IrOpcode::kReturn) {
+      // The only returns without the callee's values are the ones that
+      // {WasmGraphBuilder::Trap} emits right after an unconditional trap.
+      // They are unreachable and must not flow into the caller's returns.
+      Node* trap = NodeProperties::GetControlInput(input);
+      DCHECK_EQ(1, input->op()->ValueInputCount());
+      DCHECK_EQ(IrOpcode::kTrapUnless, trap->opcode());
+      DCHECK(Int32Matcher(NodeProperties::GetValueInput(trap, 0)).Is(0));
+      Node* terminate = graph()->NewNode(
+          common()->Throw(), NodeProperties::GetEffectInput(input), trap);
+      NodeProperties::MergeControlToEnd(graph(), common(), terminate);
+      input->Kill();
+    } else {
+      NodeProperties::MergeControlToEnd(graph(), common(), input);
+    }
+    Revisit(graph()->end());
+  }
+  callee_end->Kill();
+
+  // 3) Handle return nodes.
+  if (return_nodes.empty()) {
+    // The inlinee never returns. The call node and all its uses are dead.
+    ReplaceWithValue(call, mcgraph()->Dead(), mcgraph()->Dead(),
+                     mcgraph()->Dead());
+    return Changed(call);
+  }
+
+  int const return_count = static_cast<int>(return_nodes.size());
+  NodeVector controls(zone());
+  NodeVector effects(zone());
+  for (Node* const return_node : return_nodes) {
+    controls.push_back(NodeProperties::GetControlInput(return_node));
+    effects.push_back(NodeProperties::GetEffectInput(return_node));
+  }
+  Node* control_output = graph()->NewNode(common()->Merge(return_count),
+                                          return_count, &controls.front());
+  effects.push_back(control_output);
+  Node* effect_output =
+      graph()->NewNode(common()->EffectPhi(return_count),
+                       static_cast<int>(effects.size()), &effects.front());
+
+  // The first value input of a return node is the pop count.
+  NodeVector values(zone());
+  for (int i = 0; i < return_arity; i++) {
+    NodeVector ith_values(zone());
+    for (Node* const return_node : return_nodes) {
+      ith_values.push_back(NodeProperties::GetValueInput(return_node, i + 1));
+    }
+    ith_values.push_back(control_output);
+    MachineRepresentation rep =
+        callee_sig->GetReturn(i).machine_representation();
+    values.push_back(graph()->NewNode(common()->Phi(rep, return_count),
+                                      static_cast<int>(ith_values.size()),
+                                      &ith_values.front()));
+  }
+  for (Node* return_node : return_nodes) return_node->Kill();
+
+  if (return_arity == 1) {
+    ReplaceWithValue(call, values[0], effect_output, control_output);
+    return Replace(values[0]);
+  }
+  if (return_arity > 1) {
+    // Replace the projections of the call by the returned values.
+    for (Edge edge : call->use_edges()) {
+      if (!NodeProperties::IsValueEdge(edge)) continue;
+      Node* use = edge.from();
+      DCHECK_EQ(IrOpcode::kProjection, use->opcode());
+      ReplaceWithValue(use, values[ProjectionIndexOf(use->op())]);
+    }
+  }
+  // No value uses of the call remain, {Dead} is only a placeholder.
+  ReplaceWithValue(call, mcgraph()->Dead(), effect_output, control_output);
+  return Replace(mcgraph()->Dead());
+}
+
+#undef TRACE
+
+}  // namespace compiler
+}  // namespace internal
+}  // namespace v8
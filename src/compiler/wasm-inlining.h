@@ -0,0 +1,76 @@
+// Copyright 2021 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_COMPILER_WASM_INLINING_H_
+#define V8_COMPILER_WASM_INLINING_H_
+
+#include "src/compiler/graph-reducer.h"
+#include "src/compiler/machine-graph.h"
+#include "src/wasm/value-type.h"
+
+namespace v8 {
+namespace internal {
+
+namespace wasm {
+struct CompilationEnv;
+struct WasmModule;
+class WireBytesStorage;
+class WasmFeatures;
+}  // namespace wasm
+
+namespace compiler {
+
+class NodeOriginTable;
+class SourcePositionTable;
+
+// The WasmInliner inlines small direct callees of the function being compiled.
+// It runs on the freshly built graph, before int64 and SIMD lowering, and
+// builds the graph of each inlinee from its wire bytes. The inlined code is
+// therefore independent of the execution tier of the callee.
+class WasmInliner final : public AdvancedReducer {
+ public:
+  WasmInliner(Editor* editor, wasm::CompilationEnv* env,
+              SourcePositionTable* source_positions,
+              NodeOriginTable* node_origins, MachineGraph* mcgraph,
+              const wasm::WireBytesStorage* wire_bytes,
+              uint32_t function_index, wasm::WasmFeatures* detected);
+
+  const char* reducer_name() const override { return "WasmInliner"; }
+
+  Reduction Reduce(Node* node) final;
+
+ private:
+  Zone* zone() const { return mcgraph_->zone(); }
+  CommonOperatorBuilder* common() const { return mcgraph_->common(); }
+  Graph* graph() const { return mcgraph_->graph(); }
+  MachineGraph* mcgraph() const { return mcgraph_; }
+  const wasm::WasmModule* module() const;
+
+  // Returns the index of the function directly called by {call}, or -1.
+  int GetDirectCallee(Node* call) const;
+  bool IsInlineable(Node* call, uint32_t callee_index) const;
+
+  Reduction ReduceCall(Node* call);
+  Reduction InlineCall(Node* call, Node* callee_start, Node* callee_end,
+                       const wasm::FunctionSig* callee_sig);
+  void RewireFunctionEntry(Node* call, Node* callee_start);
+  void SetInlineeSourcePositions(Node* call, Node* callee_end,
+                                 NodeId first_inlinee_node);
+
+  wasm::CompilationEnv* const env_;
+  SourcePositionTable* const source_positions_;
+  NodeOriginTable* const node_origins_;
+  MachineGraph* const mcgraph_;
+  const wasm::WireBytesStorage* const wire_bytes_;
+  const uint32_t function_index_;
+  wasm::WasmFeatures* const detected_;
+  // Number of wire bytes which may still be inlined into this function.
+  size_t remaining_budget_;
+};
+
+}  // namespace compiler
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_COMPILER_WASM_INLINING_H_
@@ -42,6 +42,7 @@
 #include "src/execution/vm-state-inl.h"
 #include "src/flags/flags.h"
 #include "src/handles/maybe-handles.h"
+#include "src/heap/parked-scope.h"
 #include "src/init/v8.h"
 #include "src/interpreter/interpreter.h"
 #include "src/logging/counters.h"
@@ -1613,6 +1614,53 @@ void Shell::LogGetAndStop(const v8::FunctionCallbackInfo<v8::Value>& args) {
   args.GetReturnValue().Set(result);
 }
 
+namespace {
+class BackgroundJsonParseTask final : public v8::Task {
+ public:
+  BackgroundJsonParseTask(JSON::ParseTask* task, base::Semaphore* done)
+      : task_(task), done_(done) {}
+
+  void Run() override {
+    task_->Run();
+    done_->Signal();
+  }
+
+ private:
+  JSON::ParseTask* task_;
+  base::Semaphore* done_;
+};
+}  // namespace
+
+// d8.json.parseInBackground(string) parses {string} like JSON.parse, but
+// through JSON::StartParse, a background thread, and JSON::FinishParse.
+void Shell::JsonParseInBackground(
+    const v8::FunctionCallbackInfo<v8::Value>& args) {
+  Isolate* isolate = args.GetIsolate();
+  i::Isolate* i_isolate = reinterpret_cast<i::Isolate*>(isolate);
+  HandleScope handle_scope(isolate);
+  if (args.Length() < 1 || !args[0]->IsString()) {
+    Throw(isolate, "Expected a string.");
+    return;
+  }
+
+  std::unique_ptr<JSON::ParseTask> task =
+      JSON::StartParse(isolate, args[0].As<String>());
+  base::Semaphore done(0);
+  PostBlockingBackgroundTask(
+      std::make_unique<BackgroundJsonParseTask>(task.get(), &done));
+  {
+    // The background thread may need the main thread to reach a safepoint.
+    i::ParkedScope parked_scope(i_isolate->main_thread_local_isolate());
+    done.Wait();
+  }
+
+  Local<Value> result;
+  if (JSON::FinishParse(isolate->GetCurrentContext(), std::move(task))
+          .ToLocal(&result)) {
+    args.GetReturnValue().Set(result);
+  }
+}
+
 // async_hooks.createHook() registers functions to be called for different
 // lifetime events of each async operation.
 void Shell::AsyncHooksCreateHook(
@@ -2337,6 +2385,13 @@ Local<ObjectTemplate> Shell::CreateD8Template(Isolate* isolate) {
 
     d8_template->Set(isolate, "log", log_template);
   }
+  {
+    Local<ObjectTemplate> json_template = ObjectTemplate::New(isolate);
+    json_template->Set(isolate, "parseInBackground",
+                       FunctionTemplate::New(isolate, JsonParseInBackground));
+
+    d8_template->Set(isolate, "json", json_template);
+  }
   return d8_template;
 }
 
@@ -1278,6 +1278,8 @@ void JSRegExp::JSRegExpVerify(Isolate* isolate) {
       CHECK_EQ(arr.get(JSRegExp::kIrregexpTicksUntilTierUpIndex),
                uninitialized);
       CHECK_EQ(arr.get(JSRegExp::kIrregexpBacktrackLimit), uninitialized);
+      CHECK_EQ(arr.get(JSRegExp::kIrregexpPrefilterIndex), uninitialized);
+      CHECK(arr.get(JSRegExp::kIrregexpRecentlyUsedIndex).IsSmi());
       break;
     }
     case JSRegExp::IRREGEXP: {
@@ -1315,6 +1317,13 @@ void JSRegExp::JSRegExpVerify(Isolate* isolate) {
       CHECK(arr.get(JSRegExp::kIrregexpMaxRegisterCountIndex).IsSmi());
       CHECK(arr.get(JSRegExp::kIrregexpTicksUntilTierUpIndex).IsSmi());
       CHECK(arr.get(JSRegExp::kIrregexpBacktrackLimit).IsSmi());
+      // Smi : No literal prefix (-1).
+      // String: Literal prefix of every match.
+      Object prefilter = arr.get(JSRegExp::kIrregexpPrefilterIndex);
+      CHECK((prefilter.IsSmi() &&
+             Smi::ToInt(prefilter) == JSRegExp::kUninitializedValue) ||
+            prefilter.IsString());
+      CHECK(arr.get(JSRegExp::kIrregexpRecentlyUsedIndex).IsSmi());
       break;
     }
     default:
@@ -7,6 +7,7 @@
 #include <limits>
 
 #include "src/api/api-inl.h"
+#include "src/base/functional.h"
 #include "src/base/logging.h"
 #include "src/base/macros.h"
 #include "src/execution/isolate.h"
@@ -26,10 +27,42 @@ using AtomicsWaitEvent = v8::Isolate::AtomicsWaitEvent;
 
 class FutexWaitList {
  public:
+  // Number of shards which wait locations are distributed over.
+  static constexpr size_t kNumShards = 64;
+
+  struct HeadAndTail {
+    FutexWaitListNode* head;
+    FutexWaitListNode* tail;
+  };
+
+  // The mutex of a shard protects the composition of its location lists (i.e.
+  // no elements may be added or removed without holding the mutex), as well as
+  // the `waiting_` field of each node on them. It must be the mutex used
+  // together with the `cond_` condition variable of such nodes.
+  struct Shard {
+    base::Mutex mutex;
+    // Number of nodes on `location_lists`. Only modified while holding
+    // `mutex`, but read without it by FutexEmulation::Wake, which returns
+    // early if nobody waits on the shard.
+    std::atomic<int> num_waiters{0};
+    // Location inside a shared buffer -> linked list of Nodes waiting on that
+    // location.
+    std::map<int8_t*, HeadAndTail> location_lists;
+  };
+
   FutexWaitList() = default;
   FutexWaitList(const FutexWaitList&) = delete;
   FutexWaitList& operator=(const FutexWaitList&) = delete;
 
+  Shard* ShardFor(const int8_t* wait_location) {
+    size_t hash = base::hash_value(reinterpret_cast<uintptr_t>(wait_location));
+    return &shards_[hash % kNumShards];
+  }
+  Shard* ShardFor(const FutexWaitListNode* node) {
+    return ShardFor(node->wait_location_);
+  }
+
+  // Both require holding the mutex of the node's shard.
   void AddNode(FutexWaitListNode* node);
   void RemoveNode(FutexWaitListNode* node);
 
@@ -52,16 +85,19 @@ class FutexWaitList {
     return next;
   }
 
-  static void DeleteNodesForIsolate(Isolate* isolate, FutexWaitListNode** head,
-                                    FutexWaitListNode** tail) {
+  // Returns the number of deleted nodes.
+  static int DeleteNodesForIsolate(Isolate* isolate, FutexWaitListNode** head,
+                                   FutexWaitListNode** tail) {
     // For updating head & tail once we've iterated all nodes.
     FutexWaitListNode* new_head = nullptr;
     FutexWaitListNode* new_tail = nullptr;
+    int num_deleted = 0;
     auto node = *head;
     while (node != nullptr) {
       if (node->isolate_for_async_waiters_ == isolate) {
         node->timeout_task_id_ = CancelableTaskManager::kInvalidTaskId;
         node = DeleteAsyncWaiterNode(node);
+        num_deleted++;
       } else {
         if (new_head == nullptr) {
           new_head = node;
@@ -72,10 +108,15 @@ class FutexWaitList {
     }
     *head = new_head;
     *tail = new_tail;
+    return num_deleted;
   }
 
-  // For checking the internal consistency of the FutexWaitList.
-  void Verify();
+  // For checking the internal consistency of a shard. Requires holding the
+  // shard's mutex.
+  void VerifyShard(Shard* shard);
+  // For checking the internal consistency of the list of Promises to resolve.
+  // Requires holding `promises_mutex_`.
+  void VerifyPromisesToResolve();
   // Verifies the local consistency of |node|. If it's the first node of its
   // list, it must be |head|, and if it's the last node, it must be |tail|.
   void VerifyNode(FutexWaitListNode* node, FutexWaitListNode* head,
@@ -86,13 +127,11 @@ class FutexWaitList {
  private:
   friend class FutexEmulation;
 
-  struct HeadAndTail {
-    FutexWaitListNode* head;
-    FutexWaitListNode* tail;
-  };
-  // Location inside a shared buffer -> linked list of Nodes waiting on that
-  // location.
-  std::map<int8_t*, HeadAndTail> location_lists_;
+  Shard shards_[kNumShards];
+
+  // Protects `isolate_promises_to_resolve_`. It may be acquired while holding
+  // the mutex of a shard, but not the other way round.
+  base::Mutex promises_mutex_;
 
   // Isolate* -> linked list of Nodes which are waiting for their Promises to
   // be resolved.
@@ -100,12 +139,6 @@ class FutexWaitList {
 };
 
 namespace {
-// `g_mutex` protects the composition of `g_wait_list` (i.e. no elements may be
-// added or removed without holding this mutex), as well as the `waiting_`
-// and `interrupted_` fields for each individual list node that is currently
-// part of the list. It must be the mutex used together with the `cond_`
-// condition variable of such nodes.
-base::LazyMutex g_mutex = LAZY_MUTEX_INITIALIZER;
 base::LazyInstance<FutexWaitList>::type g_wait_list = LAZY_INSTANCE_INITIALIZER;
 }  // namespace
 
@@ -125,16 +158,18 @@ bool FutexWaitListNode::CancelTimeoutTask() {
 
 void FutexWaitListNode::NotifyWake() {
   DCHECK(!IsAsync());
-  // Lock the FutexEmulation mutex before notifying. We know that the mutex
-  // will have been unlocked if we are currently waiting on the condition
-  // variable. The mutex will not be locked if FutexEmulation::Wait hasn't
-  // locked it yet. In that case, we set the interrupted_
-  // flag to true, which will be tested after the mutex locked by a future wait.
-  NoGarbageCollectionMutexGuard lock_guard(g_mutex.Pointer());
-
-  // if not waiting, this will not have any effect.
+  // Set the interrupted_ flag before looking up the mutex the node waits with.
+  // The waiter publishes that mutex before testing the flag, so either it sees
+  // the flag before it starts waiting on the condition variable, or we find
+  // the mutex here. Locking the mutex before notifying guarantees that the
+  // waiter is either waiting on the condition variable already, or has not
+  // tested the flag yet. If the node is not waiting, the flag will be tested
+  // by a future wait.
+  interrupted_.store(true);
+  base::Mutex* mutex = wait_mutex_.load();
+  if (mutex == nullptr) return;
+  NoGarbageCollectionMutexGuard lock_guard(mutex);
   cond_.NotifyOne();
-  interrupted_ = true;
 }
 
 class ResolveAsyncWaiterPromisesTask : public CancelableTask {
@@ -168,18 +203,20 @@ class AsyncWaiterTimeoutTask : public CancelableTask {
 void FutexEmulation::NotifyAsyncWaiter(FutexWaitListNode* node) {
   // This function can run in any thread.
 
-  g_mutex.Pointer()->AssertHeld();
+  FutexWaitList* wait_list = g_wait_list.Pointer();
+  wait_list->ShardFor(node)->mutex.AssertHeld();
 
   // Nullify the timeout time; this distinguishes timed out waiters from
   // woken up ones.
   node->async_timeout_time_ = base::TimeTicks();
 
-  g_wait_list.Pointer()->RemoveNode(node);
+  wait_list->RemoveNode(node);
 
   // Schedule a task for resolving the Promise. It's still possible that the
   // timeout task runs before the promise resolving task. In that case, the
   // timeout task will just ignore the node.
-  auto& isolate_map = g_wait_list.Pointer()->isolate_promises_to_resolve_;
+  NoGarbageCollectionMutexGuard promises_guard(&wait_list->promises_mutex_);
+  auto& isolate_map = wait_list->isolate_promises_to_resolve_;
   auto it = isolate_map.find(node->isolate_for_async_waiters_);
   if (it == isolate_map.end()) {
     // This Isolate doesn't have other Promises to resolve at the moment.
@@ -194,27 +231,37 @@ void FutexEmulation::NotifyAsyncWaiter(FutexWaitListNode* node) {
     it->second.tail->next_ = node;
     it->second.tail = node;
   }
+  wait_list->VerifyPromisesToResolve();
 }
 
 void FutexWaitList::AddNode(FutexWaitListNode* node) {
   DCHECK_NULL(node->prev_);
   DCHECK_NULL(node->next_);
-  auto it = location_lists_.find(node->wait_location_);
-  if (it == location_lists_.end()) {
-    location_lists_.insert(
+  Shard* shard = ShardFor(node);
+  shard->mutex.AssertHeld();
+  auto& location_lists = shard->location_lists;
+  auto it = location_lists.find(node->wait_location_);
+  if (it == location_lists.end()) {
+    location_lists.insert(
         std::make_pair(node->wait_location_, HeadAndTail{node, node}));
   } else {
     it->second.tail->next_ = node;
     node->prev_ = it->second.tail;
     it->second.tail = node;
   }
+  // Sequentially consistent, so that a sync waiter's subsequent load of the
+  // waited-on value is ordered after it.
+  shard->num_waiters.fetch_add(1);
 
-  Verify();
+  VerifyShard(shard);
 }
 
 void FutexWaitList::RemoveNode(FutexWaitListNode* node) {
-  auto it = location_lists_.find(node->wait_location_);
-  DCHECK_NE(location_lists_.end(), it);
+  Shard* shard = ShardFor(node);
+  shard->mutex.AssertHeld();
+  auto& location_lists = shard->location_lists;
+  auto it = location_lists.find(node->wait_location_);
+  DCHECK_NE(location_lists.end(), it);
   DCHECK(NodeIsOnList(node, it->second.head));
 
   if (node->prev_) {
@@ -233,23 +280,20 @@ void FutexWaitList::RemoveNode(FutexWaitListNode* node) {
 
   // If the node was the last one on its list, delete the whole list.
   if (node->prev_ == nullptr && node->next_ == nullptr) {
-    location_lists_.erase(it);
+    location_lists.erase(it);
   }
 
   node->prev_ = node->next_ = nullptr;
+  shard->num_waiters.fetch_sub(1);
 
-  Verify();
+  VerifyShard(shard);
 }
 
 void AtomicsWaitWakeHandle::Wake() {
-  // Adding a separate `NotifyWake()` variant that doesn't acquire the lock
-  // itself would likely just add unnecessary complexity..
-  // The split lock by itself isn’t an issue, as long as the caller properly
-  // synchronizes this with the closing `AtomicsWaitCallback`.
-  {
-    NoGarbageCollectionMutexGuard lock_guard(g_mutex.Pointer());
-    stopped_ = true;
-  }
+  // The waiter tests stopped_ after observing the interrupt raised by
+  // `NotifyWake()`, so it has to be set first. The caller has to synchronize
+  // this with the closing `AtomicsWaitCallback`.
+  stopped_.store(true);
   isolate_->futex_wait_list_node()->NotifyWake();
 }
 
@@ -380,16 +424,18 @@ Object FutexEmulation::WaitSync(Isolate* isolate,
   AtomicsWaitEvent callback_result = AtomicsWaitEvent::kWokenUp;
 
   do {  // Not really a loop, just makes it easier to break out early.
-    NoGarbageCollectionMutexGuard lock_guard(g_mutex.Pointer());
-
     std::shared_ptr<BackingStore> backing_store =
         array_buffer->GetBackingStore();
     DCHECK(backing_store);
+    auto wait_location =
+        FutexWaitList::ToWaitLocation(backing_store.get(), addr);
+    FutexWaitList* wait_list = g_wait_list.Pointer();
+    base::Mutex* mutex = &wait_list->ShardFor(wait_location)->mutex;
+    NoGarbageCollectionMutexGuard lock_guard(mutex);
+
     FutexWaitListNode* node = isolate->futex_wait_list_node();
     node->backing_store_ = backing_store;
     node->wait_addr_ = addr;
-    auto wait_location =
-        FutexWaitList::ToWaitLocation(backing_store.get(), addr);
     node->wait_location_ = wait_location;
     node->waiting_ = true;
 
@@ -397,8 +443,15 @@ Object FutexEmulation::WaitSync(Isolate* isolate,
     // still holding the lock).
     FutexWaitListNode::ResetWaitingOnScopeExit reset_waiting(node);
 
+    // Add the node before loading the value, so that a notifier which stores
+    // a new value and then finds no waiters on the shard can't be missed.
+    wait_list->AddNode(node);
+    node->wait_mutex_.store(mutex);
+
     std::atomic<T>* p = reinterpret_cast<std::atomic<T>*>(wait_location);
     if (p->load() != value) {
+      node->wait_mutex_.store(nullptr);
+      wait_list->RemoveNode(node);
       result = handle(Smi::FromInt(WaitReturnValue::kNotEqual), isolate);
       callback_result = AtomicsWaitEvent::kNotEqual;
       break;
@@ -412,11 +465,8 @@ Object FutexEmulation::WaitSync(Isolate* isolate,
       timeout_time = current_time + rel_timeout;
     }
 
-    g_wait_list.Pointer()->AddNode(node);
-
     while (true) {
-      bool interrupted = node->interrupted_;
-      node->interrupted_ = false;
+      bool interrupted = node->interrupted_.exchange(false);
 
       // Unlock the mutex here to prevent deadlock from lock ordering between
       // mutex and mutexes locked by HandleInterrupts.
@@ -472,17 +522,17 @@ Object FutexEmulation::WaitSync(Isolate* isolate,
 
         base::TimeDelta time_until_timeout = timeout_time - current_time;
         DCHECK_GE(time_until_timeout.InMicroseconds(), 0);
-        bool wait_for_result =
-            node->cond_.WaitFor(g_mutex.Pointer(), time_until_timeout);
+        bool wait_for_result = node->cond_.WaitFor(mutex, time_until_timeout);
         USE(wait_for_result);
       } else {
-        node->cond_.Wait(g_mutex.Pointer());
+        node->cond_.Wait(mutex);
       }
 
       // Spurious wakeup, interrupt or timeout.
     }
 
-    g_wait_list.Pointer()->RemoveNode(node);
+    node->wait_mutex_.store(nullptr);
+    wait_list->RemoveNode(node);
   } while (false);
 
   isolate->RunAtomicsWaitCallback(callback_result, array_buffer, addr, value,
@@ -586,8 +636,9 @@ Object FutexEmulation::WaitAsync(Isolate* isolate,
       new FutexWaitListNode(backing_store, addr, promise_capability, isolate);
 
   {
-    NoGarbageCollectionMutexGuard lock_guard(g_mutex.Pointer());
-    g_wait_list.Pointer()->AddNode(node);
+    FutexWaitList* wait_list = g_wait_list.Pointer();
+    NoGarbageCollectionMutexGuard lock_guard(&wait_list->ShardFor(node)->mutex);
+    wait_list->AddNode(node);
   }
   if (use_timeout) {
     node->async_timeout_time_ = base::TimeTicks::Now() + rel_timeout;
@@ -618,10 +669,20 @@ Object FutexEmulation::Wake(Handle<JSArrayBuffer> array_buffer, size_t addr,
   int waiters_woken = 0;
   std::shared_ptr<BackingStore> backing_store = array_buffer->GetBackingStore();
   auto wait_location = FutexWaitList::ToWaitLocation(backing_store.get(), addr);
+  FutexWaitList* wait_list = g_wait_list.Pointer();
+  FutexWaitList::Shard* shard = wait_list->ShardFor(wait_location);
 
-  NoGarbageCollectionMutexGuard lock_guard(g_mutex.Pointer());
+  // Don't take the lock if nobody waits on any location of the shard. The
+  // value store before this notification may have been a plain, non-atomic
+  // one, so a full fence is needed to order it before the load. Together with
+  // the increment in AddNode, a sync waiter which isn't counted yet will then
+  // observe the stored value.
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+  if (shard->num_waiters.load() == 0) return Smi::zero();
 
-  auto& location_lists = g_wait_list.Pointer()->location_lists_;
+  NoGarbageCollectionMutexGuard lock_guard(&shard->mutex);
+
+  auto& location_lists = shard->location_lists;
   auto it = location_lists.find(wait_location);
   if (it == location_lists.end()) {
     return Smi::zero();
@@ -690,7 +751,7 @@ Object FutexEmulation::Wake(Handle<JSArrayBuffer> array_buffer, size_t addr,
     if (delete_this_node) {
       auto old_node = node;
       node = node->next_;
-      g_wait_list.Pointer()->RemoveNode(old_node);
+      wait_list->RemoveNode(old_node);
       DCHECK_EQ(CancelableTaskManager::kInvalidTaskId,
                 old_node->timeout_task_id_);
       delete old_node;
@@ -704,7 +765,8 @@ Object FutexEmulation::Wake(Handle<JSArrayBuffer> array_buffer, size_t addr,
 
 void FutexEmulation::CleanupAsyncWaiterPromise(FutexWaitListNode* node) {
   // This function must run in the main thread of node's Isolate. This function
-  // may allocate memory. To avoid deadlocks, we shouldn't be holding g_mutex.
+  // may allocate memory. To avoid deadlocks, we shouldn't be holding any
+  // wait list mutex.
 
   DCHECK(FLAG_harmony_atomics_waitasync);
   DCHECK(node->IsAsync());
@@ -783,9 +845,10 @@ void FutexEmulation::ResolveAsyncWaiterPromises(Isolate* isolate) {
 
   FutexWaitListNode* node;
   {
-    NoGarbageCollectionMutexGuard lock_guard(g_mutex.Pointer());
+    FutexWaitList* wait_list = g_wait_list.Pointer();
+    NoGarbageCollectionMutexGuard lock_guard(&wait_list->promises_mutex_);
 
-    auto& isolate_map = g_wait_list.Pointer()->isolate_promises_to_resolve_;
+    auto& isolate_map = wait_list->isolate_promises_to_resolve_;
     auto it = isolate_map.find(isolate);
     DCHECK_NE(isolate_map.end(), it);
 
@@ -817,7 +880,8 @@ void FutexEmulation::HandleAsyncWaiterTimeout(FutexWaitListNode* node) {
   DCHECK(node->IsAsync());
 
   {
-    NoGarbageCollectionMutexGuard lock_guard(g_mutex.Pointer());
+    FutexWaitList* wait_list = g_wait_list.Pointer();
+    NoGarbageCollectionMutexGuard lock_guard(&wait_list->ShardFor(node)->mutex);
 
     node->timeout_task_id_ = CancelableTaskManager::kInvalidTaskId;
     if (!node->waiting_) {
@@ -825,7 +889,7 @@ void FutexEmulation::HandleAsyncWaiterTimeout(FutexWaitListNode* node) {
       // resolved. Ignore the timeout.
       return;
     }
-    g_wait_list.Pointer()->RemoveNode(node);
+    wait_list->RemoveNode(node);
   }
 
   // "node" has been taken out of the lists, so it's ok to access it without
@@ -838,19 +902,22 @@ void FutexEmulation::HandleAsyncWaiterTimeout(FutexWaitListNode* node) {
 }
 
 void FutexEmulation::IsolateDeinit(Isolate* isolate) {
-  NoGarbageCollectionMutexGuard lock_guard(g_mutex.Pointer());
+  FutexWaitList* wait_list = g_wait_list.Pointer();
 
   // Iterate all locations to find nodes belonging to "isolate" and delete them.
   // The Isolate is going away; don't bother cleaning up the Promises in the
   // NativeContext. Also we don't need to cancel the timeout tasks, since they
   // will be cancelled by Isolate::Deinit.
-  {
-    auto& location_lists = g_wait_list.Pointer()->location_lists_;
+  for (FutexWaitList::Shard& shard : wait_list->shards_) {
+    NoGarbageCollectionMutexGuard lock_guard(&shard.mutex);
+    auto& location_lists = shard.location_lists;
     auto it = location_lists.begin();
     while (it != location_lists.end()) {
       FutexWaitListNode*& head = it->second.head;
       FutexWaitListNode*& tail = it->second.tail;
-      FutexWaitList::DeleteNodesForIsolate(isolate, &head, &tail);
+      int num_deleted =
+          FutexWaitList::DeleteNodesForIsolate(isolate, &head, &tail);
+      shard.num_waiters.fetch_sub(num_deleted);
       // head and tail are either both nullptr or both non-nullptr.
       DCHECK_EQ(head == nullptr, tail == nullptr);
       if (head == nullptr) {
@@ -859,10 +926,12 @@ void FutexEmulation::IsolateDeinit(Isolate* isolate) {
         ++it;
       }
     }
+    wait_list->VerifyShard(&shard);
   }
 
   {
-    auto& isolate_map = g_wait_list.Pointer()->isolate_promises_to_resolve_;
+    NoGarbageCollectionMutexGuard lock_guard(&wait_list->promises_mutex_);
+    auto& isolate_map = wait_list->isolate_promises_to_resolve_;
     auto it = isolate_map.find(isolate);
     if (it != isolate_map.end()) {
       auto node = it->second.head;
@@ -873,9 +942,8 @@ void FutexEmulation::IsolateDeinit(Isolate* isolate) {
       }
       isolate_map.erase(it);
     }
+    wait_list->VerifyPromisesToResolve();
   }
-
-  g_wait_list.Pointer()->Verify();
 }
 
 Object FutexEmulation::NumWaitersForTesting(Handle<JSArrayBuffer> array_buffer,
@@ -883,10 +951,11 @@ Object FutexEmulation::NumWaitersForTesting(Handle<JSArrayBuffer> array_buffer,
   DCHECK_LT(addr, array_buffer->byte_length());
   std::shared_ptr<BackingStore> backing_store = array_buffer->GetBackingStore();
 
-  NoGarbageCollectionMutexGuard lock_guard(g_mutex.Pointer());
-
   auto wait_location = FutexWaitList::ToWaitLocation(backing_store.get(), addr);
-  auto& location_lists = g_wait_list.Pointer()->location_lists_;
+  FutexWaitList::Shard* shard = g_wait_list.Pointer()->ShardFor(wait_location);
+  NoGarbageCollectionMutexGuard lock_guard(&shard->mutex);
+
+  auto& location_lists = shard->location_lists;
   auto it = location_lists.find(wait_location);
   if (it == location_lists.end()) {
     return Smi::zero();
@@ -907,16 +976,17 @@ Object FutexEmulation::NumWaitersForTesting(Handle<JSArrayBuffer> array_buffer,
 }
 
 Object FutexEmulation::NumAsyncWaitersForTesting(Isolate* isolate) {
-  NoGarbageCollectionMutexGuard lock_guard(g_mutex.Pointer());
-
   int waiters = 0;
-  for (const auto& it : g_wait_list.Pointer()->location_lists_) {
-    FutexWaitListNode* node = it.second.head;
-    while (node != nullptr) {
-      if (node->isolate_for_async_waiters_ == isolate && node->waiting_) {
-        waiters++;
+  for (FutexWaitList::Shard& shard : g_wait_list.Pointer()->shards_) {
+    NoGarbageCollectionMutexGuard lock_guard(&shard.mutex);
+    for (const auto& it : shard.location_lists) {
+      FutexWaitListNode* node = it.second.head;
+      while (node != nullptr) {
+        if (node->isolate_for_async_waiters_ == isolate && node->waiting_) {
+          waiters++;
+        }
+        node = node->next_;
       }
-      node = node->next_;
     }
   }
 
@@ -927,11 +997,12 @@ Object FutexEmulation::NumUnresolvedAsyncPromisesForTesting(
     Handle<JSArrayBuffer> array_buffer, size_t addr) {
   DCHECK_LT(addr, array_buffer->byte_length());
   std::shared_ptr<BackingStore> backing_store = array_buffer->GetBackingStore();
+  FutexWaitList* wait_list = g_wait_list.Pointer();
 
-  NoGarbageCollectionMutexGuard lock_guard(g_mutex.Pointer());
+  NoGarbageCollectionMutexGuard lock_guard(&wait_list->promises_mutex_);
 
   int waiters = 0;
-  auto& isolate_map = g_wait_list.Pointer()->isolate_promises_to_resolve_;
+  auto& isolate_map = wait_list->isolate_promises_to_resolve_;
   for (const auto& it : isolate_map) {
     FutexWaitListNode* node = it.second.head;
     while (node != nullptr) {
@@ -974,16 +1045,24 @@ void FutexWaitList::VerifyNode(FutexWaitListNode* node, FutexWaitListNode* head,
 #endif  // DEBUG
 }
 
-void FutexWaitList::Verify() {
+void FutexWaitList::VerifyShard(Shard* shard) {
 #ifdef DEBUG
-  for (const auto& it : location_lists_) {
+  int num_waiters = 0;
+  for (const auto& it : shard->location_lists) {
+    DCHECK_EQ(shard, ShardFor(it.first));
     FutexWaitListNode* node = it.second.head;
     while (node != nullptr) {
       VerifyNode(node, it.second.head, it.second.tail);
       node = node->next_;
+      num_waiters++;
     }
   }
+  DCHECK_EQ(num_waiters, shard->num_waiters.load());
+#endif  // DEBUG
+}
 
+void FutexWaitList::VerifyPromisesToResolve() {
+#ifdef DEBUG
   for (const auto& it : isolate_promises_to_resolve_) {
     auto node = it.second.head;
     while (node != nullptr) {
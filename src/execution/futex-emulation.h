@@ -7,6 +7,7 @@
 
 #include <stdint.h>
 
+#include <atomic>
 #include <map>
 
 #include "include/v8.h"
@@ -22,7 +23,9 @@
 // Support for emulating futexes, a low-level synchronization primitive. They
 // are natively supported by Linux, but must be emulated for other platforms.
 // This library emulates them on all platforms using mutexes and condition
-// variables for consistency.
+// variables for consistency. Waiters are kept in wait lists which are sharded
+// by wait location, so that waiting on and notifying unrelated locations does
+// not contend on a single lock.
 //
 // This is used by the Futex API defined in the SharedArrayBuffer draft spec,
 // found here: https://github.com/tc39/ecmascript_sharedmem
@@ -48,11 +51,11 @@ class AtomicsWaitWakeHandle {
   explicit AtomicsWaitWakeHandle(Isolate* isolate) : isolate_(isolate) {}
 
   void Wake();
-  inline bool has_stopped() const { return stopped_; }
+  inline bool has_stopped() const { return stopped_.load(); }
 
  private:
   Isolate* isolate_;
-  bool stopped_ = false;
+  std::atomic<bool> stopped_{false};
 };
 
 class FutexWaitListNode {
@@ -96,7 +99,9 @@ class FutexWaitListNode {
   CancelableTaskManager* cancelable_task_manager_ = nullptr;
 
   base::ConditionVariable cond_;
-  // prev_ and next_ are protected by FutexEmulation::mutex_.
+  // prev_ and next_ are protected by the mutex of the wait list shard which
+  // wait_location_ maps to, or by the mutex of the list of Promises to resolve
+  // once the node has been moved there.
   FutexWaitListNode* prev_ = nullptr;
   FutexWaitListNode* next_ = nullptr;
 
@@ -113,11 +118,18 @@ class FutexWaitListNode {
   // update the head and tail of the list).
   int8_t* wait_location_ = nullptr;
 
-  // waiting_ and interrupted_ are protected by FutexEmulation::mutex_
-  // if this node is currently contained in FutexEmulation::wait_list_
-  // or an AtomicsWaitWakeHandle has access to it.
+  // waiting_ is protected by the mutex of the wait list shard which
+  // wait_location_ maps to, while the node is on a wait list.
   bool waiting_ = false;
-  bool interrupted_ = false;
+
+  // Set by NotifyWake() from any thread. A sync waiter checks it while holding
+  // the mutex it waits with, which NotifyWake() acquires before signalling
+  // cond_, so that no interrupt is lost.
+  std::atomic<bool> interrupted_{false};
+
+  // Only for sync FutexWaitListNodes: the mutex which cond_ is currently used
+  // with, or nullptr if the node isn't waiting.
+  std::atomic<base::Mutex*> wait_mutex_{nullptr};
 
   // Only for async FutexWaitListNodes. Weak Global handle. Must not be
   // synchronously resolved by a non-owner Isolate.
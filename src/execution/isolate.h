@@ -95,6 +95,7 @@ class OptimizingCompileDispatcher;
 class PersistentHandles;
 class PersistentHandlesList;
 class ReadOnlyArtifacts;
+class RegExpCodeBudget;
 class RegExpStack;
 class RootVisitor;
 class RuntimeProfiler;
@@ -1137,6 +1138,8 @@ class V8_EXPORT_PRIVATE Isolate final : private HiddenFactory {
 
   RegExpStack* regexp_stack() { return regexp_stack_; }
 
+  RegExpCodeBudget* regexp_code_budget() { return regexp_code_budget_; }
+
   size_t total_regexp_code_generated() { return total_regexp_code_generated_; }
   void IncreaseTotalRegexpCodeGenerated(Handle<HeapObject> code);
 
@@ -1822,6 +1825,7 @@ class V8_EXPORT_PRIVATE Isolate final : private HiddenFactory {
       regexp_macro_assembler_canonicalize_;
 #endif  // !V8_INTL_SUPPORT
   RegExpStack* regexp_stack_ = nullptr;
+  RegExpCodeBudget* regexp_code_budget_ = nullptr;
   std::vector<int> regexp_indices_;
   DateCache* date_cache_ = nullptr;
   base::RandomNumberGenerator* random_number_generator_ = nullptr;
@@ -878,6 +878,17 @@ DEFINE_BOOL(wasm_stack_checks, true,
             "enable stack checks (disable for performance testing only)")
 DEFINE_BOOL(wasm_math_intrinsics, true,
             "intrinsify some Math imports into wasm")
+DEFINE_BOOL(wasm_inlining, false,
+            "inline small direct callees into TurboFan-compiled wasm functions")
+DEFINE_INT(wasm_inlining_max_size, 30,
+           "maximum body size (in bytes) of a wasm function to be inlined")
+DEFINE_INT(wasm_inlining_budget, 1000,
+           "maximum total body size (in bytes) of the wasm functions inlined "
+           "into one function")
+DEFINE_BOOL(trace_wasm_inlining, false, "trace wasm inlining decisions")
+DEFINE_BOOL(wasm_speculative_call_indirect, false,
+            "guard a direct call to the only function of matching signature "
+            "in table 0 at call_indirect sites in optimized wasm code")
 
 DEFINE_BOOL(wasm_trap_handler, true,
             "use signal handlers to catch out of bounds memory access in wasm"
@@ -901,6 +912,9 @@ DEFINE_BOOL(wasm_lazy_validation, false,
 
 DEFINE_BOOL(wasm_grow_shared_memory, true,
             "allow growing shared WebAssembly memory objects")
+DEFINE_BOOL(wasm_huge_pages, false,
+            "back WebAssembly memories with transparent huge pages where "
+            "supported")
 DEFINE_BOOL(wasm_simd_post_mvp, false,
             "allow experimental SIMD operations for prototyping that are not "
             "included in the current proposal")
@@ -1061,6 +1075,9 @@ DEFINE_GENERIC_IMPLICATION(
 DEFINE_SIZE_T(
     zone_stats_tolerance, 1 * MB,
     "report a tick only when allocated zone memory changes by this amount")
+DEFINE_INT(zone_segment_pool_size, 256,
+           "maximum size (in KB) of freed zone segments that are kept for "
+           "reuse by later zones")
 DEFINE_BOOL(trace_zone_type_stats, false, "trace per-type zone memory usage")
 DEFINE_GENERIC_IMPLICATION(
     trace_zone_type_stats,
@@ -1292,6 +1309,10 @@ DEFINE_BOOL(always_osr, false, "always try to OSR functions")
 DEFINE_BOOL(prepare_always_opt, false, "prepare for turning on always opt")
 
 DEFINE_BOOL(trace_serializer, false, "print code serializer trace")
+DEFINE_BOOL(code_cache_recompile_flushed, false,
+            "recompile functions whose bytecode was flushed before creating a "
+            "code cache, so that they don't need to be reparsed after it is "
+            "consumed")
 #ifdef DEBUG
 DEFINE_BOOL(external_reference_stats, false,
             "print statistics on external references used during serialization")
@@ -1388,6 +1409,11 @@ DEFINE_BOOL(allow_natives_for_differential_fuzzing, false,
 DEFINE_IMPLICATION(allow_natives_for_differential_fuzzing, allow_natives_syntax)
 DEFINE_IMPLICATION(allow_natives_for_differential_fuzzing, fuzzing)
 DEFINE_BOOL(parse_only, false, "only parse the sources")
+DEFINE_BOOL(parallel_preparse, false,
+            "preparse the top-level functions of large scripts on worker "
+            "threads")
+DEFINE_INT(parallel_preparse_min_size, 512,
+           "minimum size in KB of scripts to preparse in parallel")
 
 // simulator-arm.cc, simulator-arm64.cc and simulator-mips.cc
 DEFINE_BOOL(trace_sim, false, "Trace simulator execution")
@@ -1488,9 +1514,23 @@ DEFINE_BOOL(regexp_tier_up, true,
             "number of executions set by the tier up ticks flag")
 DEFINE_INT(regexp_tier_up_ticks, 1,
            "set the number of executions for the regexp interpreter before "
-           "tiering-up to the compiler")
+           "tiering-up to the compiler; executions on long subjects or with "
+           "many backtracks count as several")
+DEFINE_SIZE_T(regexp_native_code_budget, 0,
+              "maximum size of native regexp code per isolate (in KBytes), "
+              "beyond which the code of the least recently used regexps is "
+              "dropped (0 means unlimited)")
+DEFINE_SIZE_T(regexp_shared_bytecode_cache_size, 0,
+              "maximum size of the process-wide cache of regexp bytecode "
+              "shared between isolates (in KBytes, 0 disables the cache)")
 DEFINE_BOOL(regexp_peephole_optimization, REGEXP_PEEPHOLE_OPTIMIZATION_BOOL,
             "enable peephole optimization for regexp bytecode")
+DEFINE_BOOL(regexp_elide_stack_checks, true,
+            "check the backtrack stack limit once per match attempt for "
+            "regexps without loops, instead of on pushes")
+DEFINE_BOOL(regexp_prefilter, true,
+            "search the subject for the literal prefix of a regexp before "
+            "running the matcher")
 DEFINE_BOOL(trace_regexp_peephole_optimization, false,
             "trace regexp bytecode peephole optimization")
 DEFINE_BOOL(trace_regexp_bytecodes, false, "trace regexp bytecode execution")
@@ -3181,6 +3181,8 @@ void Factory::SetRegExpIrregexpData(Handle<JSRegExp> regexp,
   store->set(JSRegExp::kIrregexpCaptureNameMapIndex, uninitialized);
   store->set(JSRegExp::kIrregexpTicksUntilTierUpIndex, ticks_until_tier_up);
   store->set(JSRegExp::kIrregexpBacktrackLimit, Smi::FromInt(backtrack_limit));
+  store->set(JSRegExp::kIrregexpPrefilterIndex, uninitialized);
+  store->set(JSRegExp::kIrregexpRecentlyUsedIndex, Smi::zero());
   regexp->set_data(*store);
 }
 
@@ -3203,6 +3205,8 @@ void Factory::SetRegExpExperimentalData(Handle<JSRegExp> regexp,
   store->set(JSRegExp::kIrregexpCaptureNameMapIndex, uninitialized);
   store->set(JSRegExp::kIrregexpTicksUntilTierUpIndex, uninitialized);
   store->set(JSRegExp::kIrregexpBacktrackLimit, uninitialized);
+  store->set(JSRegExp::kIrregexpPrefilterIndex, uninitialized);
+  store->set(JSRegExp::kIrregexpRecentlyUsedIndex, Smi::zero());
   regexp->set_data(*store);
 }
 
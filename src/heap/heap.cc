@@ -92,6 +92,7 @@
 #include "src/tracing/trace-event.h"
 #include "src/utils/utils-inl.h"
 #include "src/utils/utils.h"
+#include "src/zone/accounting-allocator.h"
 
 #ifdef V8_ENABLE_CONSERVATIVE_STACK_SCANNING
 #include "src/heap/conservative-stack-visitor.h"
@@ -3725,6 +3726,9 @@ bool Heap::IdleNotification(double deadline_in_seconds) {
       gc_idle_time_handler_->Compute(idle_time_in_ms, heap_state);
 
   bool result = PerformIdleTimeAction(action, heap_state, deadline_in_ms);
+  // Zone segments are pooled for back-to-back compilations, which are
+  // unlikely to happen while the embedder is idle.
+  isolate()->allocator()->ReleasePooledSegments();
 
   IdleNotificationEpilogue(action, heap_state, start_ms, deadline_in_ms);
   return result;
@@ -3786,6 +3790,7 @@ void Heap::CollectGarbageOnMemoryPressure() {
                     GarbageCollectionReason::kMemoryPressure,
                     kGCCallbackFlagCollectAllAvailableGarbage);
   EagerlyFreeExternalMemory();
+  isolate()->allocator()->ReleasePooledSegments();
   double end = MonotonicallyIncreasingTimeInMs();
 
   // Estimate how much memory we can free.
@@ -4796,7 +4801,8 @@ void Heap::RecordStats(HeapStats* stats, bool take_snapshot) {
       memory_allocator()->Size() + memory_allocator()->Available();
   *stats->os_error = base::OS::GetLastError();
   // TODO(leszeks): Include the string table in both current and peak usage.
-  *stats->malloced_memory = isolate_->allocator()->GetCurrentMemoryUsage();
+  *stats->malloced_memory = isolate_->allocator()->GetCurrentMemoryUsage() +
+                            isolate_->allocator()->GetCurrentPoolSize();
   *stats->malloced_peak_memory = isolate_->allocator()->GetMaxMemoryUsage();
   if (take_snapshot) {
     HeapObjectIterator iterator(this);
@@ -2152,6 +2152,7 @@ void MarkCompactCollector::FlushBytecodeFromSFI(
   int start_position = shared_info.StartPosition();
   int end_position = shared_info.EndPosition();
 
+  shared_info.set_has_flushed_bytecode(true);
   shared_info.DiscardCompiledMetadata(
       isolate(), [](HeapObject object, ObjectSlot slot, HeapObject target) {
         RecordSlot(object, slot, target);
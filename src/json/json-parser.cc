@@ -4,8 +4,15 @@
 
 #include "src/json/json-parser.h"
 
+#include "src/base/functional.h"
 #include "src/common/message-template.h"
 #include "src/debug/debug.h"
+#include "src/execution/local-isolate.h"
+#include "src/handles/local-handles-inl.h"
+#include "src/handles/persistent-handles.h"
+#include "src/heap/local-factory-inl.h"
+#include "src/heap/local-heap-inl.h"
+#include "src/heap/parked-scope.h"
 #include "src/numbers/conversions.h"
 #include "src/numbers/hash-seed-inl.h"
 #include "src/objects/field-type.h"
@@ -14,6 +21,7 @@
 #include "src/objects/property-descriptor.h"
 #include "src/strings/char-predicates-inl.h"
 #include "src/strings/string-hasher.h"
+#include "src/utils/word-units.h"
 
 namespace v8 {
 namespace internal {
@@ -115,6 +123,116 @@ static const constexpr uint8_t character_json_scan_flags[256] = {
 #undef CALL_GET_SCAN_FLAGS
 };
 
+// Returns the first character in [cursor, end) that may terminate a JSON
+// string, or a character before it. On 64-bit little-endian hosts, one-byte
+// input is scanned a word at a time; the caller scans the rest.
+template <typename Char>
+const Char* SkipJsonStringCharacters(const Char* cursor, const Char* end) {
+  return cursor;
+}
+
+// Returns the first non-whitespace character in [cursor, end), or a
+// whitespace character before it, in the same way.
+template <typename Char>
+const Char* SkipJsonWhitespace(const Char* cursor, const Char* end) {
+  return cursor;
+}
+
+#if defined(V8_TARGET_LITTLE_ENDIAN) && V8_HOST_ARCH_64_BIT
+template <>
+const uint8_t* SkipJsonStringCharacters(const uint8_t* cursor,
+                                        const uint8_t* end) {
+  using U = WordUnits<uint8_t>;
+  for (; end - cursor >= U::kPerWord; cursor += U::kPerWord) {
+    U::Word word = U::Load(cursor);
+    U::Word terminators =
+        U::Equal(word, '"') | U::Equal(word, '\\') | U::Below(word, 0x20);
+    if (terminators != 0) return cursor + U::IndexOfFirst(terminators);
+  }
+  return cursor;
+}
+
+template <>
+const uint8_t* SkipJsonWhitespace(const uint8_t* cursor, const uint8_t* end) {
+  using U = WordUnits<uint8_t>;
+  for (; end - cursor >= U::kPerWord; cursor += U::kPerWord) {
+    U::Word word = U::Load(cursor);
+    U::Word others = (U::Equal(word, ' ') | U::Equal(word, '\n') |
+                      U::Equal(word, '\r') | U::Equal(word, '\t')) ^
+                     U::kHighBits;
+    if (others != 0) return cursor + U::IndexOfFirst(others);
+  }
+  return cursor;
+}
+#endif  // defined(V8_TARGET_LITTLE_ENDIAN) && V8_HOST_ARCH_64_BIT
+
+// Converts a syntactically valid JSON number exactly if it has at most 15
+// significant digits and a decimal exponent of at most 22: both the digits
+// and the power of ten are then exact doubles, so a single multiplication or
+// division rounds correctly. Returns false for other numbers, which need
+// StringToDouble.
+template <typename Char>
+bool TryFastJsonNumberToDouble(Vector<const Char> chars, double* result) {
+#if (V8_TARGET_ARCH_IA32 || defined(USE_SIMULATOR)) && !defined(_MSC_VER)
+  // As in DoubleStrtod, the x87 floating-point stack may round twice.
+  return false;
+#else
+  static constexpr double kExactPowersOfTen[] = {
+      1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+      1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22};
+  static constexpr int kMaxExponent = arraysize(kExactPowersOfTen) - 1;
+  static constexpr int kMaxSignificantDigits = 15;
+
+  const Char* cursor = chars.begin();
+  const Char* end = chars.end();
+  bool negative = *cursor == '-';
+  if (negative) cursor++;
+
+  uint64_t significand = 0;
+  int digits = 0;
+  int exponent = 0;
+  auto add_digit = [&](Char c) {
+    // Leading zeros are not significant.
+    if (significand == 0 && c == '0') return true;
+    if (++digits > kMaxSignificantDigits) return false;
+    significand = significand * 10 + (c - '0');
+    return true;
+  };
+  for (; cursor != end && IsDecimalDigit(*cursor); cursor++) {
+    if (!add_digit(*cursor)) return false;
+  }
+  if (cursor != end && *cursor == '.') {
+    for (cursor++; cursor != end && IsDecimalDigit(*cursor); cursor++) {
+      if (!add_digit(*cursor)) return false;
+      exponent--;
+    }
+  }
+  if (cursor != end) {
+    DCHECK_EQ('e', AsciiAlphaToLower(*cursor));
+    cursor++;
+    bool negative_exponent = *cursor == '-';
+    if (*cursor == '-' || *cursor == '+') cursor++;
+    int value = 0;
+    for (; cursor != end; cursor++) {
+      DCHECK(IsDecimalDigit(*cursor));
+      value = value * 10 + (*cursor - '0');
+      if (value > 2 * kMaxExponent) return false;
+    }
+    exponent += negative_exponent ? -value : value;
+  }
+  if (exponent < -kMaxExponent || exponent > kMaxExponent) return false;
+
+  double value = static_cast<double>(significand);
+  if (exponent < 0) {
+    value /= kExactPowersOfTen[-exponent];
+  } else {
+    value *= kExactPowersOfTen[exponent];
+  }
+  *result = negative ? -value : value;
+  return true;
+#endif
+}
+
 }  // namespace
 
 MaybeHandle<Object> JsonParseInternalizer::Internalize(Isolate* isolate,
@@ -205,6 +323,8 @@ JsonParser<Char>::JsonParser(Isolate* isolate, Handle<String> source)
     : isolate_(isolate),
       hash_seed_(HashSeed(isolate)),
       object_constructor_(isolate_->object_function()),
+      shape_cache_(
+          handle(ReadOnlyRoots(isolate).empty_fixed_array(), isolate)),
       original_source_(source) {
   size_t start = 0;
   size_t length = source->length();
@@ -319,6 +439,7 @@ template <typename Char>
 void JsonParser<Char>::SkipWhitespace() {
   next_ = JsonToken::EOS;
 
+  cursor_ = SkipJsonWhitespace(cursor_, end_);
   cursor_ = std::find_if(cursor_, end_, [this](Char c) {
     JsonToken current = V8_LIKELY(c <= unibrow::Latin1::kMaxChar)
                             ? one_char_json_tokens[c]
@@ -398,6 +519,47 @@ Handle<Map> ParentOfDescriptorOwner(Isolate* isolate, Handle<Map> maybe_root,
 }
 }  // namespace
 
+template <typename Char>
+size_t JsonParser<Char>::KeySequenceFingerprint(
+    size_t start, const std::vector<JsonProperty>& property_stack) {
+  DisallowGarbageCollection no_gc;
+  size_t fingerprint = 0;
+  for (size_t i = start; i < property_stack.size(); i++) {
+    const JsonString& key = property_stack[i].string;
+    if (key.is_index()) continue;
+    // The length and the first and last characters tell most keys apart,
+    // without reading all of them.
+    int length = key.length();
+    const Char* chars = chars_ + key.start();
+    fingerprint = base::hash_combine(fingerprint, length,
+                                     length > 0 ? chars[0] : 0,
+                                     length > 0 ? chars[length - 1] : 0);
+  }
+  return fingerprint;
+}
+
+template <typename Char>
+Handle<Map> JsonParser<Char>::LookupShape(size_t fingerprint) {
+  if (shape_cache_->length() == 0) {
+    shape_cache_.PatchValue(*factory()->NewFixedArray(kShapeCacheSize));
+    return Handle<Map>();
+  }
+  Object entry = shape_cache_->get(fingerprint & (kShapeCacheSize - 1));
+  if (!entry.IsMap()) return Handle<Map>();
+  Map map = Map::cast(entry);
+  // The map may have been detached from the transition tree since.
+  if (map.IsDetached(isolate_)) return Handle<Map>();
+  Handle<Map> result = handle(map, isolate_);
+  if (result->is_deprecated()) result = Map::Update(isolate_, result);
+  return result;
+}
+
+template <typename Char>
+void JsonParser<Char>::InsertShape(size_t fingerprint, Handle<Map> map) {
+  if (map->is_dictionary_map()) return;
+  shape_cache_->set(fingerprint & (kShapeCacheSize - 1), *map);
+}
+
 template <typename Char>
 Handle<Object> JsonParser<Char>::BuildJsonObject(
     const JsonContinuation& cont,
@@ -406,6 +568,18 @@ Handle<Object> JsonParser<Char>::BuildJsonObject(
   int length = static_cast<int>(property_stack.size() - start);
   int named_length = length - cont.elements;
 
+  // Consult the shape cache if there is no feedback from a sibling, or if the
+  // sibling has a different number of properties.
+  bool use_shape_cache = named_length > 0 &&
+                         (feedback.is_null() ||
+                          feedback->NumberOfOwnDescriptors() != named_length);
+  size_t fingerprint = 0;
+  if (use_shape_cache) {
+    fingerprint = KeySequenceFingerprint(start, property_stack);
+    Handle<Map> shape = LookupShape(fingerprint);
+    if (!shape.is_null()) feedback = shape;
+  }
+
   Handle<Map> initial_map = factory()->ObjectLiteralMapFromCache(
       isolate_->native_context(), named_length);
 
@@ -652,6 +826,9 @@ Handle<Object> JsonParser<Char>::BuildJsonObject(
     JSObject::DefineOwnPropertyIgnoreAttributes(&it, value, NONE).Check();
   }
 
+  if (use_shape_cache) {
+    InsertShape(fingerprint, handle(object->map(), isolate_));
+  }
   return object;
 }
 
@@ -969,9 +1146,11 @@ Handle<Object> JsonParser<Char>::ParseJsonNumber() {
     }
 
     Vector<const Char> chars(start, cursor_ - start);
-    number = StringToDouble(chars,
-                            NO_FLAGS,  // Hex, octal or trailing junk.
-                            std::numeric_limits<double>::quiet_NaN());
+    if (!TryFastJsonNumberToDouble(chars, &number)) {
+      number = StringToDouble(chars,
+                              NO_FLAGS,  // Hex, octal or trailing junk.
+                              std::numeric_limits<double>::quiet_NaN());
+    }
 
     DCHECK(!std::isnan(number));
   }
@@ -1118,6 +1297,7 @@ JsonString JsonParser<Char>::ScanJsonString(bool needs_internalization) {
   uc32 bits = 0;
 
   while (true) {
+    cursor_ = SkipJsonStringCharacters(cursor_, end_);
     cursor_ = std::find_if(cursor_, end_, [&bits](Char c) {
       if (sizeof(Char) == 2 && V8_UNLIKELY(c > unibrow::Latin1::kMaxChar)) {
         bits |= c;
@@ -1196,6 +1376,479 @@ JsonString JsonParser<Char>::ScanJsonString(bool needs_internalization) {
   return JsonString();
 }
 
+template <typename Char>
+class JsonParseTask::Scanner final {
+ public:
+  Scanner(LocalIsolate* isolate, JsonParseTask* task, const Char* chars,
+          size_t length)
+      : isolate_(isolate), task_(task), cursor_(chars), end_(chars + length) {}
+
+  // Returns false on the first syntax error.
+  bool Parse();
+
+ private:
+  JsonToken SkipWhitespace() {
+    cursor_ = SkipJsonWhitespace(cursor_, end_);
+    cursor_ = std::find_if(cursor_, end_, [](Char c) {
+      return c > unibrow::Latin1::kMaxChar ||
+             one_char_json_tokens[c] != JsonToken::WHITESPACE;
+    });
+    if (cursor_ == end_) return JsonToken::EOS;
+    if (*cursor_ > unibrow::Latin1::kMaxChar) return JsonToken::ILLEGAL;
+    return one_char_json_tokens[*cursor_];
+  }
+
+  bool Check(JsonToken token) {
+    if (SkipWhitespace() != token) return false;
+    cursor_++;
+    return true;
+  }
+
+  template <size_t N>
+  bool ScanLiteral(const char (&s)[N]) {
+    if (static_cast<size_t>(end_ - cursor_) < N - 1 ||
+        !CompareCharsEqual(s, cursor_, N - 1)) {
+      return false;
+    }
+    cursor_ += N - 1;
+    return true;
+  }
+
+  bool ScanPropertyKey() {
+    return Check(JsonToken::STRING) && ScanString(true) &&
+           Check(JsonToken::COLON);
+  }
+
+  bool ScanString(bool is_key);
+  bool ScanNumber();
+
+  template <typename SrcChar>
+  Handle<String> MakeString(Vector<const SrcChar> chars, bool is_one_byte,
+                            bool internalize);
+
+  void EmitValue(Object value) {
+    task_->values_.push_back(isolate_->heap()->NewPersistentHandle(value));
+    task_->instructions_.push_back({Instruction::kValue, 0});
+  }
+
+  LocalIsolate* const isolate_;
+  JsonParseTask* const task_;
+  const Char* cursor_;
+  const Char* const end_;
+  // Characters of the current string, if it has escapes.
+  std::vector<uint16_t> buffer_;
+};
+
+template <typename Char>
+bool JsonParseTask::Scanner<Char>::Parse() {
+  struct Container {
+    bool is_object;
+    uint32_t count;
+  };
+  std::vector<Container> stack;
+  LocalFactory* factory = isolate_->factory();
+
+  while (true) {
+    // The scanner only holds persistent handles between values, so this is a
+    // good point to let the main thread's GC in. Checking is cheap.
+    isolate_->heap()->Safepoint();
+
+    // Produce a value, or start an object or array and loop to produce its
+    // first member.
+    switch (SkipWhitespace()) {
+      case JsonToken::STRING:
+        cursor_++;
+        if (!ScanString(false)) return false;
+        break;
+
+      case JsonToken::NUMBER:
+        if (!ScanNumber()) return false;
+        break;
+
+      case JsonToken::LBRACE:
+        cursor_++;
+        if (Check(JsonToken::RBRACE)) {
+          task_->instructions_.push_back({Instruction::kObject, 0});
+          break;
+        }
+        stack.push_back({true, 0});
+        if (!ScanPropertyKey()) return false;
+        continue;
+
+      case JsonToken::LBRACK:
+        cursor_++;
+        if (Check(JsonToken::RBRACK)) {
+          task_->instructions_.push_back({Instruction::kArray, 0});
+          break;
+        }
+        stack.push_back({false, 0});
+        continue;
+
+      case JsonToken::TRUE_LITERAL:
+        if (!ScanLiteral("true")) return false;
+        EmitValue(*factory->true_value());
+        break;
+
+      case JsonToken::FALSE_LITERAL:
+        if (!ScanLiteral("false")) return false;
+        EmitValue(*factory->false_value());
+        break;
+
+      case JsonToken::NULL_LITERAL:
+        if (!ScanLiteral("null")) return false;
+        EmitValue(*factory->null_value());
+        break;
+
+      default:
+        return false;
+    }
+
+    // Add the produced value to its container, and close containers for as
+    // long as they end.
+    while (true) {
+      if (stack.empty()) return SkipWhitespace() == JsonToken::EOS;
+      Container& container = stack.back();
+      container.count++;
+      if (Check(JsonToken::COMMA)) {
+        if (container.is_object && !ScanPropertyKey()) return false;
+        break;
+      }
+      if (!Check(container.is_object ? JsonToken::RBRACE
+                                     : JsonToken::RBRACK)) {
+        return false;
+      }
+      task_->instructions_.push_back(
+          {container.is_object ? Instruction::kObject : Instruction::kArray,
+           container.count});
+      stack.pop_back();
+    }
+  }
+}
+
+template <typename Char>
+bool JsonParseTask::Scanner<Char>::ScanString(bool is_key) {
+  const Char* start = cursor_;
+  bool has_escape = false;
+  uc32 bits = 0;
+  while (true) {
+    cursor_ = SkipJsonStringCharacters(cursor_, end_);
+    cursor_ = std::find_if(cursor_, end_, [&bits](Char c) {
+      if (sizeof(Char) == 2 && V8_UNLIKELY(c > unibrow::Latin1::kMaxChar)) {
+        bits |= c;
+        return false;
+      }
+      return MayTerminateJsonString(character_json_scan_flags[c]);
+    });
+    if (cursor_ == end_) return false;
+    if (*cursor_ == '"') break;
+    // Control characters are not allowed in strings.
+    if (*cursor_ != '\\') return false;
+    has_escape = true;
+    if (++cursor_ == end_ || *cursor_ > unibrow::Latin1::kMaxChar) {
+      return false;
+    }
+    switch (GetEscapeKind(character_json_scan_flags[*cursor_])) {
+      case EscapeKind::kIllegal:
+        return false;
+      case EscapeKind::kUnicode: {
+        if (end_ - cursor_ <= 4) return false;
+        uc32 value = 0;
+        for (int i = 0; i < 4; i++) {
+          int digit = HexValue(*++cursor_);
+          if (digit < 0) return false;
+          value = value * 16 + digit;
+        }
+        bits |= value;
+        break;
+      }
+      default:
+        break;
+    }
+    cursor_++;
+  }
+  Vector<const Char> chars(start, cursor_ - start);
+  cursor_++;
+
+  // Like JsonParser, internalize keys and short strings.
+  const int kMaxInternalizedStringValueLength = 10;
+  bool internalize =
+      is_key || chars.length() <= kMaxInternalizedStringValueLength;
+  bool is_one_byte = bits <= unibrow::Latin1::kMaxChar;
+  LocalHandleScope scope(isolate_);
+  if (!has_escape) {
+    EmitValue(*MakeString(chars, is_one_byte, internalize));
+    return true;
+  }
+
+  buffer_.clear();
+  for (const Char* cursor = chars.begin(); cursor < chars.end(); cursor++) {
+    if (*cursor != '\\') {
+      buffer_.push_back(*cursor);
+      continue;
+    }
+    cursor++;
+    switch (GetEscapeKind(character_json_scan_flags[*cursor])) {
+      case EscapeKind::kSelf:
+        buffer_.push_back(*cursor);
+        break;
+      case EscapeKind::kBackspace:
+        buffer_.push_back('\x08');
+        break;
+      case EscapeKind::kTab:
+        buffer_.push_back('\x09');
+        break;
+      case EscapeKind::kNewLine:
+        buffer_.push_back('\x0A');
+        break;
+      case EscapeKind::kFormFeed:
+        buffer_.push_back('\x0C');
+        break;
+      case EscapeKind::kCarriageReturn:
+        buffer_.push_back('\x0D');
+        break;
+      case EscapeKind::kUnicode: {
+        uc32 value = 0;
+        for (int i = 0; i < 4; i++) {
+          value = value * 16 + HexValue(*++cursor);
+        }
+        buffer_.push_back(value);
+        break;
+      }
+      case EscapeKind::kIllegal:
+        UNREACHABLE();
+    }
+  }
+  EmitValue(*MakeString(VectorOf(buffer_), is_one_byte, internalize));
+  return true;
+}
+
+template <typename Char>
+template <typename SrcChar>
+Handle<String> JsonParseTask::Scanner<Char>::MakeString(
+    Vector<const SrcChar> chars, bool is_one_byte, bool internalize) {
+  LocalFactory* factory = isolate_->factory();
+  if (chars.empty()) return factory->empty_string();
+  if (internalize) {
+    return factory->InternalizeString(chars,
+                                      sizeof(SrcChar) == 2 && is_one_byte);
+  }
+  DisallowGarbageCollection no_gc;
+  if (is_one_byte) {
+    Handle<SeqOneByteString> string =
+        factory->NewRawOneByteString(chars.length(), AllocationType::kOld)
+            .ToHandleChecked();
+    CopyChars(string->GetChars(no_gc), chars.begin(), chars.length());
+    return string;
+  }
+  Handle<SeqTwoByteString> string =
+      factory->NewRawTwoByteString(chars.length(), AllocationType::kOld)
+          .ToHandleChecked();
+  CopyChars(string->GetChars(no_gc), chars.begin(), chars.length());
+  return string;
+}
+
+template <typename Char>
+bool JsonParseTask::Scanner<Char>::ScanNumber() {
+  // The same grammar as JsonParser::ParseJsonNumber, which reports the errors.
+  const Char* start = cursor_;
+  auto is_decimal_digit = [](Char c) { return IsDecimalDigit(c); };
+  auto is_number_part = [this]() {
+    return cursor_ != end_ && *cursor_ <= unibrow::Latin1::kMaxChar &&
+           IsNumberPart(character_json_scan_flags[*cursor_]);
+  };
+  bool negative = *cursor_ == '-';
+  if (negative) cursor_++;
+  if (cursor_ == end_) return false;
+
+  if (*cursor_ == '0') {
+    cursor_++;
+    if (cursor_ != end_ && IsDecimalDigit(*cursor_)) return false;
+  } else {
+    const Char* smi_start = cursor_;
+    cursor_ = std::find_if_not(cursor_, end_, is_decimal_digit);
+    if (cursor_ == smi_start) return false;
+    const int kMaxSmiLength = 9;
+    if (cursor_ - smi_start <= kMaxSmiLength && !is_number_part()) {
+      int32_t value = 0;
+      for (; smi_start != cursor_; smi_start++) {
+        value = value * 10 + (*smi_start - '0');
+      }
+      EmitValue(Smi::FromInt(negative ? -value : value));
+      return true;
+    }
+  }
+
+  if (cursor_ != end_ && *cursor_ == '.') {
+    cursor_++;
+    if (cursor_ == end_ || !IsDecimalDigit(*cursor_)) return false;
+    cursor_ = std::find_if_not(cursor_, end_, is_decimal_digit);
+  }
+  if (cursor_ != end_ && AsciiAlphaToLower(*cursor_) == 'e') {
+    cursor_++;
+    if (cursor_ != end_ && (*cursor_ == '-' || *cursor_ == '+')) cursor_++;
+    if (cursor_ == end_ || !IsDecimalDigit(*cursor_)) return false;
+    cursor_ = std::find_if_not(cursor_, end_, is_decimal_digit);
+  }
+
+  Vector<const Char> chars(start, cursor_ - start);
+  double number;
+  if (!TryFastJsonNumberToDouble(chars, &number)) {
+    number = StringToDouble(chars, NO_FLAGS,
+                            std::numeric_limits<double>::quiet_NaN());
+  }
+  DCHECK(!std::isnan(number));
+  LocalHandleScope scope(isolate_);
+  EmitValue(*isolate_->factory()->NewNumber<AllocationType::kOld>(number));
+  return true;
+}
+
+JsonParseTask::JsonParseTask(Isolate* isolate, Handle<String> source)
+    : isolate_(isolate) {
+  source = String::Flatten(isolate, source);
+  DisallowGarbageCollection no_gc;
+  String::FlatContent content = source->GetFlatContent(no_gc);
+  is_one_byte_ = content.IsOneByte();
+  if (is_one_byte_) {
+    Vector<const uint8_t> chars = content.ToOneByteVector();
+    one_byte_source_.assign(chars.begin(), chars.end());
+  } else {
+    Vector<const uc16> chars = content.ToUC16Vector();
+    two_byte_source_.assign(chars.begin(), chars.end());
+  }
+}
+
+JsonParseTask::~JsonParseTask() = default;
+
+void JsonParseTask::Run() {
+  DCHECK(instructions_.empty());
+  // Background threads can only allocate with concurrent allocation. Without
+  // it, Finalize() parses the source on the main thread instead. It does the
+  // same when the task is run on the isolate's own thread, which can't have
+  // a background LocalIsolate.
+  if (!FLAG_concurrent_allocation) return;
+  if (ThreadId::Current() == isolate_->thread_id()) return;
+  LocalIsolate isolate(isolate_, ThreadKind::kBackground);
+  UnparkedScope unparked_scope(&isolate);
+  LocalHandleScope handle_scope(&isolate);
+  if (is_one_byte_) {
+    succeeded_ = Scanner<uint8_t>(&isolate, this, one_byte_source_.data(),
+                                  one_byte_source_.size())
+                     .Parse();
+  } else {
+    succeeded_ = Scanner<uint16_t>(&isolate, this, two_byte_source_.data(),
+                                   two_byte_source_.size())
+                     .Parse();
+  }
+  persistent_handles_ = isolate.heap()->DetachPersistentHandles();
+}
+
+MaybeHandle<Object> JsonParseTask::Finalize(Isolate* isolate) {
+  DCHECK_EQ(isolate, isolate_);
+  Handle<Object> undefined = isolate->factory()->undefined_value();
+  if (!succeeded_) {
+    // Run() bailed out, most likely on a syntax error.
+    if (is_one_byte_) {
+      Handle<String> source = isolate->factory()
+                                  ->NewStringFromOneByte(
+                                      VectorOf(one_byte_source_))
+                                  .ToHandleChecked();
+      return JsonParser<uint8_t>::Parse(isolate, source, undefined);
+    }
+    Handle<String> source =
+        isolate->factory()
+            ->NewStringFromTwoByte(VectorOf(two_byte_source_))
+            .ToHandleChecked();
+    return JsonParser<uint16_t>::Parse(isolate, source, undefined);
+  }
+
+  HandleScope scope(isolate);
+  std::vector<Handle<Object>> stack;
+  size_t next_value = 0;
+  for (const Instruction& instruction : instructions_) {
+    switch (instruction.op) {
+      case Instruction::kValue:
+        stack.push_back(values_[next_value++]);
+        break;
+      case Instruction::kObject: {
+        size_t start = stack.size() - 2 * instruction.count;
+        Handle<Object> object =
+            BuildObject(isolate, stack.data() + start, instruction.count);
+        stack.resize(start);
+        stack.push_back(object);
+        break;
+      }
+      case Instruction::kArray: {
+        size_t start = stack.size() - instruction.count;
+        Handle<Object> array =
+            BuildArray(isolate, stack.data() + start, instruction.count);
+        stack.resize(start);
+        stack.push_back(array);
+        break;
+      }
+    }
+  }
+  DCHECK_EQ(next_value, values_.size());
+  DCHECK_EQ(1u, stack.size());
+  return scope.CloseAndEscape(stack.back());
+}
+
+Handle<Object> JsonParseTask::BuildObject(Isolate* isolate,
+                                          const Handle<Object>* members,
+                                          uint32_t count) {
+  Handle<Map> map = isolate->factory()->ObjectLiteralMapFromCache(
+      isolate->native_context(), static_cast<int>(count));
+  Handle<JSObject> object =
+      map->is_dictionary_map()
+          ? isolate->factory()->NewSlowJSObjectFromMap(map)
+          : isolate->factory()->NewJSObjectFromMap(map);
+  for (uint32_t i = 0; i < count; i++) {
+    HandleScope scope(isolate);
+    // Keys are internalized, so the lookup key recognizes array indices.
+    LookupIterator::Key key(isolate, Handle<Name>::cast(members[2 * i]));
+    LookupIterator it(isolate, object, key, object, LookupIterator::OWN);
+    JSObject::DefineOwnPropertyIgnoreAttributes(&it, members[2 * i + 1], NONE)
+        .Check();
+  }
+  return object;
+}
+
+Handle<Object> JsonParseTask::BuildArray(Isolate* isolate,
+                                         const Handle<Object>* elements,
+                                         uint32_t count) {
+  // Same as JsonParser::BuildJsonArray.
+  ElementsKind kind = PACKED_SMI_ELEMENTS;
+  for (uint32_t i = 0; i < count; i++) {
+    Object value = *elements[i];
+    if (value.IsHeapObject()) {
+      if (HeapObject::cast(value).IsHeapNumber()) {
+        kind = PACKED_DOUBLE_ELEMENTS;
+      } else {
+        kind = PACKED_ELEMENTS;
+        break;
+      }
+    }
+  }
+
+  int length = static_cast<int>(count);
+  Handle<JSArray> array = isolate->factory()->NewJSArray(kind, length, length);
+  DisallowGarbageCollection no_gc;
+  if (kind == PACKED_DOUBLE_ELEMENTS) {
+    FixedDoubleArray array_elements = FixedDoubleArray::cast(array->elements());
+    for (int i = 0; i < length; i++) {
+      array_elements.set(i, elements[i]->Number());
+    }
+  } else {
+    FixedArray array_elements = FixedArray::cast(array->elements());
+    WriteBarrierMode mode = kind == PACKED_SMI_ELEMENTS
+                                ? SKIP_WRITE_BARRIER
+                                : array_elements.GetWriteBarrierMode(no_gc);
+    for (int i = 0; i < length; i++) {
+      array_elements.set(i, *elements[i], mode);
+    }
+  }
+  return array;
+}
+
 // Explicit instantiation.
 template class JsonParser<uint8_t>;
 template class JsonParser<uint16_t>;
@@ -5,6 +5,9 @@
 #ifndef V8_JSON_JSON_PARSER_H_
 #define V8_JSON_JSON_PARSER_H_
 
+#include <memory>
+#include <vector>
+
 #include "src/execution/isolate.h"
 #include "src/heap/factory.h"
 #include "src/objects/objects.h"
@@ -292,6 +295,18 @@ class JsonParser final {
       const JsonContinuation& cont,
       const std::vector<Handle<Object>>& element_stack);
 
+  // Objects with the same key sequence usually end up with the same map, even
+  // when they are not adjacent elements of an array (e.g. records nested in
+  // records, or arrays mixing a few kinds of records). The shape cache maps a
+  // fingerprint of the named keys of an object to the map of the last object
+  // built with them, which BuildJsonObject then uses as feedback. A stale or
+  // colliding entry only fails the key checks that feedback goes through.
+  static const int kShapeCacheSize = 32;
+  size_t KeySequenceFingerprint(
+      size_t start, const std::vector<JsonProperty>& property_stack);
+  Handle<Map> LookupShape(size_t fingerprint);
+  void InsertShape(size_t fingerprint, Handle<Map> map);
+
   // Mark that a parsing error has happened at the current character.
   void ReportUnexpectedCharacter(uc32 c);
   // Mark that a parsing error has happened at the current token.
@@ -336,6 +351,8 @@ class JsonParser final {
   // Indicates whether the bytes underneath source_ can relocate during GC.
   bool chars_may_relocate_;
   Handle<JSFunction> object_constructor_;
+  // Allocated with the first object; see LookupShape.
+  Handle<FixedArray> shape_cache_;
   const Handle<String> original_source_;
   Handle<String> source_;
 
@@ -349,6 +366,68 @@ class JsonParser final {
   const Char* chars_;
 };
 
+class LocalIsolate;
+class PersistentHandles;
+
+// Parses a JSON string in two phases, so that most of the work can happen on
+// a background thread (see v8::JSON::StartParse). Run() scans the source and
+// allocates its strings and numbers through a LocalIsolate, internalizing
+// property keys in the shared string table. It records the structure of the
+// document in postfix order, which Finalize() replays on the main thread to
+// create the objects and arrays, since these need maps from the native
+// context.
+//
+// Run() gives up on the first syntax error; Finalize() then parses the source
+// again on the main thread, which throws the same SyntaxError as JSON.parse.
+class V8_EXPORT_PRIVATE JsonParseTask final {
+ public:
+  JsonParseTask(Isolate* isolate, Handle<String> source);
+  ~JsonParseTask();
+  JsonParseTask(const JsonParseTask&) = delete;
+  JsonParseTask& operator=(const JsonParseTask&) = delete;
+
+  // May be called on any thread.
+  void Run();
+
+  // Must be called on the isolate's thread, after Run().
+  MaybeHandle<Object> Finalize(Isolate* isolate);
+
+ private:
+  template <typename Char>
+  class Scanner;
+
+  struct Instruction {
+    enum Op : uint8_t {
+      // Push the next entry of values_.
+      kValue,
+      // Pop {count} key/value pairs and push an object with these properties.
+      kObject,
+      // Pop {count} values and push an array with these elements.
+      kArray
+    };
+    Op op;
+    uint32_t count;
+  };
+
+  Handle<Object> BuildObject(Isolate* isolate, const Handle<Object>* members,
+                             uint32_t count);
+  Handle<Object> BuildArray(Isolate* isolate, const Handle<Object>* elements,
+                            uint32_t count);
+
+  Isolate* const isolate_;
+  // The source is copied so that it can be read without a heap access.
+  std::vector<uint8_t> one_byte_source_;
+  std::vector<uint16_t> two_byte_source_;
+  bool is_one_byte_;
+  bool succeeded_ = false;
+
+  std::vector<Instruction> instructions_;
+  // Strings and numbers allocated in Run(), in the order in which they appear
+  // in the source. The handles are owned by persistent_handles_.
+  std::vector<Handle<Object>> values_;
+  std::unique_ptr<PersistentHandles> persistent_handles_;
+};
+
 // Explicit instantiation declarations.
 extern template class JsonParser<uint8_t>;
 extern template class JsonParser<uint16_t>;
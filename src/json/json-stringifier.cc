@@ -4,6 +4,11 @@
 
 #include "src/json/json-stringifier.h"
 
+#include <algorithm>
+#include <memory>
+#include <vector>
+
+#include "include/v8-profiler.h"
 #include "src/common/message-template.h"
 #include "src/numbers/conversions.h"
 #include "src/objects/heap-number-inl.h"
@@ -14,6 +19,7 @@
 #include "src/objects/ordered-hash-table.h"
 #include "src/objects/smi.h"
 #include "src/strings/string-builder-inl.h"
+#include "src/strings/unicode-inl.h"
 #include "src/utils/utils.h"
 
 namespace v8 {
@@ -29,6 +35,9 @@ class JsonStringifier {
                                                       Handle<Object> replacer,
                                                       Handle<Object> gap);
 
+  V8_WARN_UNUSED_RESULT Maybe<bool> StringifyToStream(
+      Handle<Object> object, Handle<Object> gap, v8::OutputStream* stream);
+
  private:
   enum Result { UNCHANGED, SUCCESS, EXCEPTION };
 
@@ -82,6 +91,35 @@ class JsonStringifier {
   V8_INLINE Result SerializeJSObject(Handle<JSObject> object,
                                      Handle<Object> key);
 
+  // The enumerable string-keyed properties of a fast-mode map, when these are
+  // all data fields, with their keys already escaped (as "key":). Serializing
+  // an object along a plan skips the descriptor checks and the escaping of
+  // every key.
+  struct SerializationPlan {
+    struct Entry {
+      InternalIndex descriptor;
+      // Range of the escaped key in {keys}, or a negative {key_length} if the
+      // key needs to be escaped at each use.
+      int key_start;
+      int key_length;
+    };
+    std::vector<Entry> entries;
+    std::vector<uint8_t> keys;
+  };
+  // Returns the plan for {map}, or nullptr. Plans are only made for maps that
+  // have been seen before during this call, so that one-off objects do not
+  // pay for them.
+  std::shared_ptr<const SerializationPlan> GetSerializationPlan(
+      Handle<Map> map);
+  std::shared_ptr<const SerializationPlan> MakeSerializationPlan(
+      Handle<Map> map);
+  Result SerializeJSObjectWithPlan(Handle<JSObject> object, Handle<Map> map,
+                                   const SerializationPlan& plan, bool* comma);
+  // Serializes {value} with an escaped key, if it is a primitive that
+  // Serialize_ would write without calling into JavaScript.
+  bool TrySerializePlannedProperty(Handle<Object> value, bool comma,
+                                   Vector<const uint8_t> escaped_key);
+
   Result SerializeJSProxy(Handle<JSProxy> object, Handle<Object> key);
   Result SerializeJSReceiverSlow(Handle<JSReceiver> object);
   Result SerializeArrayLikeSlow(Handle<JSReceiver> object, uint32_t start,
@@ -124,6 +162,8 @@ class JsonStringifier {
 
   Isolate* isolate_;
   IncrementalStringBuilder builder_;
+  // Set while streaming the result instead of building a string.
+  bool streaming_ = false;
   Handle<String> tojson_string_;
   Handle<FixedArray> property_list_;
   Handle<JSReceiver> replacer_function_;
@@ -133,6 +173,17 @@ class JsonStringifier {
   using KeyObject = std::pair<Handle<Object>, Handle<Object>>;
   std::vector<KeyObject> stack_;
 
+  // The maps most recently serialized with the fast path, and their plans.
+  // {plan_maps_} is allocated with the first such map.
+  static const int kSerializationPlanCacheSize = 8;
+  struct PlanCacheEntry {
+    bool planned = false;
+    std::shared_ptr<const SerializationPlan> plan;
+  };
+  Handle<FixedArray> plan_maps_;
+  PlanCacheEntry plan_cache_[kSerializationPlanCacheSize];
+  int next_plan_cache_entry_ = 0;
+
   static const int kJsonEscapeTableEntrySize = 8;
   static const char* const JsonEscapeTable;
 };
@@ -143,6 +194,106 @@ MaybeHandle<Object> JsonStringify(Isolate* isolate, Handle<Object> object,
   return stringifier.Stringify(object, replacer, gap);
 }
 
+Maybe<bool> JsonStringifyToStream(Isolate* isolate, Handle<Object> object,
+                                  Handle<Object> gap,
+                                  v8::OutputStream* stream) {
+  JsonStringifier stringifier(isolate);
+  return stringifier.StringifyToStream(object, gap, stream);
+}
+
+namespace {
+
+// Encodes the output of a streaming JsonStringifier as UTF-8, and writes it
+// to an OutputStream in chunks of the size that the stream asks for.
+class JsonOutputStreamWriter final : public IncrementalStringBuilder::Sink {
+ public:
+  explicit JsonOutputStreamWriter(v8::OutputStream* stream)
+      : stream_(stream), chunk_(std::max(stream->GetChunkSize(), 1)) {}
+
+  bool Write(Vector<const uint8_t> chars) override {
+    if (!PutPendingLeadSurrogate()) return false;
+    for (uint8_t c : chars) {
+      char bytes[unibrow::Utf8::kMaxEncodedSize];
+      unsigned length = unibrow::Utf8::EncodeOneByte(bytes, c);
+      if (!Put(bytes, length)) return false;
+    }
+    return true;
+  }
+
+  bool Write(Vector<const uc16> chars) override {
+    for (uc16 c : chars) {
+      // A surrogate pair may be split between two parts. Strings are escaped
+      // by JSON.stringify, but the gap is not, so it may contain lone
+      // surrogates. These have no UTF-8 encoding and are written as U+FFFD,
+      // like String::WriteUtf8 does with REPLACE_INVALID_UTF8.
+      if (lead_surrogate_ != 0 && unibrow::Utf16::IsTrailSurrogate(c)) {
+        uint32_t code_point =
+            unibrow::Utf16::CombineSurrogatePair(lead_surrogate_, c);
+        lead_surrogate_ = 0;
+        if (!PutCodePoint(code_point)) return false;
+        continue;
+      }
+      if (!PutPendingLeadSurrogate()) return false;
+      if (unibrow::Utf16::IsLeadSurrogate(c)) {
+        lead_surrogate_ = c;
+        continue;
+      }
+      uint32_t code_point = unibrow::Utf16::IsTrailSurrogate(c)
+                                ? unibrow::Utf8::kBadChar
+                                : static_cast<uint32_t>(c);
+      if (!PutCodePoint(code_point)) return false;
+    }
+    return true;
+  }
+
+  // Writes out the last chunk. Returns false if the stream aborted.
+  bool Flush() { return PutPendingLeadSurrogate() && FlushChunk(); }
+
+ private:
+  // Replaces a lead surrogate that turned out not to be followed by a trail
+  // surrogate.
+  bool PutPendingLeadSurrogate() {
+    if (lead_surrogate_ == 0) return true;
+    lead_surrogate_ = 0;
+    return PutCodePoint(unibrow::Utf8::kBadChar);
+  }
+
+  bool PutCodePoint(uint32_t code_point) {
+    DCHECK(!unibrow::Utf16::IsLeadSurrogate(code_point));
+    DCHECK(!unibrow::Utf16::IsTrailSurrogate(code_point));
+    char bytes[unibrow::Utf8::kMaxEncodedSize];
+    unsigned length = unibrow::Utf8::Encode(
+        bytes, code_point, unibrow::Utf16::kNoPreviousCharacter);
+    return Put(bytes, length);
+  }
+
+  V8_INLINE bool Put(const char* bytes, unsigned length) {
+    for (unsigned i = 0; i < length; i++) {
+      chunk_[position_++] = bytes[i];
+      if (position_ == static_cast<int>(chunk_.size()) && !FlushChunk()) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  bool FlushChunk() {
+    if (aborted_ || position_ == 0) return !aborted_;
+    aborted_ = stream_->WriteAsciiChunk(chunk_.data(), position_) ==
+               v8::OutputStream::kAbort;
+    position_ = 0;
+    return !aborted_;
+  }
+
+  v8::OutputStream* const stream_;
+  std::vector<char> chunk_;
+  int position_ = 0;
+  uc16 lead_surrogate_ = 0;
+  bool aborted_ = false;
+};
+
+}  // namespace
+
 // Translation table to escape Latin1 characters.
 // Table entries start at a multiple of 8 and are null-terminated.
 const char* const JsonStringifier::JsonEscapeTable =
@@ -216,7 +367,8 @@ JsonStringifier::JsonStringifier(Isolate* isolate)
       builder_(isolate),
       gap_(nullptr),
       indent_(0),
-      stack_() {
+      stack_(),
+      plan_maps_(handle(ReadOnlyRoots(isolate).empty_fixed_array(), isolate)) {
   tojson_string_ = factory()->toJSON_string();
 }
 
@@ -234,6 +386,29 @@ MaybeHandle<Object> JsonStringifier::Stringify(Handle<Object> object,
   return MaybeHandle<Object>();
 }
 
+Maybe<bool> JsonStringifier::StringifyToStream(Handle<Object> object,
+                                               Handle<Object> gap,
+                                               v8::OutputStream* stream) {
+  if (!gap->IsUndefined(isolate_) && !InitializeGap(gap)) {
+    return Nothing<bool>();
+  }
+  JsonOutputStreamWriter writer(stream);
+  builder_.StreamTo(&writer);
+  streaming_ = true;
+  Result result = SerializeObject(object);
+  if (result == EXCEPTION) {
+    // Serialization also stops once the stream aborts.
+    if (isolate_->has_pending_exception()) return Nothing<bool>();
+    DCHECK(builder_.HasOverflowed());
+    return Just(false);
+  }
+  if (result == UNCHANGED) return Just(false);
+  DCHECK_EQ(SUCCESS, result);
+  if (!builder_.FinishStreaming() || !writer.Flush()) return Just(false);
+  stream->EndOfStream();
+  return Just(true);
+}
+
 bool JsonStringifier::InitializeReplacer(Handle<Object> replacer) {
   DCHECK(property_list_.is_null());
   DCHECK(replacer_function_.is_null());
@@ -521,6 +696,8 @@ JsonStringifier::Result JsonStringifier::Serialize_(Handle<Object> object,
       isolate_->stack_guard()->HandleInterrupts().IsException(isolate_)) {
     return EXCEPTION;
   }
+  // Stop early once the output stream has aborted.
+  if (streaming_ && builder_.HasOverflowed()) return EXCEPTION;
   if (object->IsJSReceiver() || object->IsBigInt()) {
     ASSIGN_RETURN_ON_EXCEPTION_VALUE(
         isolate_, object, ApplyToJsonFunction(object, key), EXCEPTION);
@@ -768,32 +945,38 @@ JsonStringifier::Result JsonStringifier::SerializeJSObject(
     DCHECK(!object->HasIndexedInterceptor());
     DCHECK(!object->HasNamedInterceptor());
     Handle<Map> map(object->map(), isolate_);
+    std::shared_ptr<const SerializationPlan> plan = GetSerializationPlan(map);
     builder_.AppendCharacter('{');
     Indent();
     bool comma = false;
-    for (InternalIndex i : map->IterateOwnDescriptors()) {
-      Handle<Name> name(map->instance_descriptors(kRelaxedLoad).GetKey(i),
-                        isolate_);
-      // TODO(rossberg): Should this throw?
-      if (!name->IsString()) continue;
-      Handle<String> key = Handle<String>::cast(name);
-      PropertyDetails details =
-          map->instance_descriptors(kRelaxedLoad).GetDetails(i);
-      if (details.IsDontEnum()) continue;
-      Handle<Object> property;
-      if (details.location() == kField && *map == object->map()) {
-        DCHECK_EQ(kData, details.kind());
-        FieldIndex field_index = FieldIndex::ForDescriptor(*map, i);
-        property = JSObject::FastPropertyAt(object, details.representation(),
-                                            field_index);
-      } else {
-        ASSIGN_RETURN_ON_EXCEPTION_VALUE(
-            isolate_, property,
-            Object::GetPropertyOrElement(isolate_, object, key), EXCEPTION);
-      }
-      Result result = SerializeProperty(property, comma, key);
-      if (!comma && result == SUCCESS) comma = true;
+    if (plan) {
+      Result result = SerializeJSObjectWithPlan(object, map, *plan, &comma);
       if (result == EXCEPTION) return result;
+    } else {
+      for (InternalIndex i : map->IterateOwnDescriptors()) {
+        Handle<Name> name(map->instance_descriptors(kRelaxedLoad).GetKey(i),
+                          isolate_);
+        // TODO(rossberg): Should this throw?
+        if (!name->IsString()) continue;
+        Handle<String> key = Handle<String>::cast(name);
+        PropertyDetails details =
+            map->instance_descriptors(kRelaxedLoad).GetDetails(i);
+        if (details.IsDontEnum()) continue;
+        Handle<Object> property;
+        if (details.location() == kField && *map == object->map()) {
+          DCHECK_EQ(kData, details.kind());
+          FieldIndex field_index = FieldIndex::ForDescriptor(*map, i);
+          property = JSObject::FastPropertyAt(object, details.representation(),
+                                              field_index);
+        } else {
+          ASSIGN_RETURN_ON_EXCEPTION_VALUE(
+              isolate_, property,
+              Object::GetPropertyOrElement(isolate_, object, key), EXCEPTION);
+        }
+        Result result = SerializeProperty(property, comma, key);
+        if (!comma && result == SUCCESS) comma = true;
+        if (result == EXCEPTION) return result;
+      }
     }
     Unindent();
     if (comma) NewLine();
@@ -806,6 +989,131 @@ JsonStringifier::Result JsonStringifier::SerializeJSObject(
   return SUCCESS;
 }
 
+std::shared_ptr<const JsonStringifier::SerializationPlan>
+JsonStringifier::GetSerializationPlan(Handle<Map> map) {
+  if (plan_maps_->length() == 0) {
+    plan_maps_.PatchValue(
+        *factory()->NewFixedArray(kSerializationPlanCacheSize));
+  }
+  for (int i = 0; i < kSerializationPlanCacheSize; i++) {
+    if (plan_maps_->get(i) != *map) continue;
+    PlanCacheEntry& entry = plan_cache_[i];
+    if (!entry.planned) {
+      entry.planned = true;
+      entry.plan = MakeSerializationPlan(map);
+    }
+    return entry.plan;
+  }
+  // Replace the oldest entry. The plan itself stays alive while objects that
+  // use it are being serialized.
+  int i = next_plan_cache_entry_;
+  next_plan_cache_entry_ = (i + 1) % kSerializationPlanCacheSize;
+  plan_maps_->set(i, *map);
+  plan_cache_[i] = PlanCacheEntry();
+  return nullptr;
+}
+
+std::shared_ptr<const JsonStringifier::SerializationPlan>
+JsonStringifier::MakeSerializationPlan(Handle<Map> map) {
+  DisallowGarbageCollection no_gc;
+  auto plan = std::make_shared<SerializationPlan>();
+  DescriptorArray descriptors = map->instance_descriptors(kRelaxedLoad);
+  for (InternalIndex i : map->IterateOwnDescriptors()) {
+    Name name = descriptors.GetKey(i);
+    if (!name.IsString()) continue;
+    PropertyDetails details = descriptors.GetDetails(i);
+    if (details.IsDontEnum()) continue;
+    // Accessors may change the object while it is being serialized.
+    if (details.location() != kField) return nullptr;
+    DCHECK_EQ(kData, details.kind());
+
+    int key_start = static_cast<int>(plan->keys.size());
+    int key_length = -1;
+    String key = String::cast(name);
+    String::FlatContent content = key.GetFlatContent(no_gc);
+    if (content.IsOneByte()) {
+      Vector<const uint8_t> chars = content.ToOneByteVector();
+      // One-byte characters other than these escape to themselves.
+      if (std::none_of(chars.begin(), chars.end(), [](uint8_t c) {
+            return c < 0x20 || c == '"' || c == '\\';
+          })) {
+        plan->keys.push_back('"');
+        plan->keys.insert(plan->keys.end(), chars.begin(), chars.end());
+        plan->keys.push_back('"');
+        plan->keys.push_back(':');
+        key_length = static_cast<int>(plan->keys.size()) - key_start;
+      }
+    }
+    plan->entries.push_back({i, key_start, key_length});
+  }
+  return plan;
+}
+
+JsonStringifier::Result JsonStringifier::SerializeJSObjectWithPlan(
+    Handle<JSObject> object, Handle<Map> map, const SerializationPlan& plan,
+    bool* comma) {
+  for (const SerializationPlan::Entry& entry : plan.entries) {
+    Handle<Object> property;
+    if (*map == object->map()) {
+      // Field representations may have been generalized in place since the
+      // plan was made, so the details are read again.
+      PropertyDetails details =
+          map->instance_descriptors(kRelaxedLoad).GetDetails(entry.descriptor);
+      FieldIndex field_index =
+          FieldIndex::ForDescriptor(*map, entry.descriptor);
+      property = JSObject::FastPropertyAt(object, details.representation(),
+                                          field_index);
+    } else {
+      Handle<String> key(String::cast(map->instance_descriptors(kRelaxedLoad)
+                                          .GetKey(entry.descriptor)),
+                         isolate_);
+      ASSIGN_RETURN_ON_EXCEPTION_VALUE(
+          isolate_, property,
+          Object::GetPropertyOrElement(isolate_, object, key), EXCEPTION);
+    }
+    if (entry.key_length >= 0 &&
+        TrySerializePlannedProperty(
+            property, *comma,
+            Vector<const uint8_t>(plan.keys.data() + entry.key_start,
+                                  entry.key_length))) {
+      *comma = true;
+      continue;
+    }
+    Handle<String> key(String::cast(map->instance_descriptors(kRelaxedLoad)
+                                        .GetKey(entry.descriptor)),
+                       isolate_);
+    Result result = SerializeProperty(property, *comma, key);
+    if (!*comma && result == SUCCESS) *comma = true;
+    if (result == EXCEPTION) return result;
+  }
+  return SUCCESS;
+}
+
+bool JsonStringifier::TrySerializePlannedProperty(
+    Handle<Object> value, bool comma, Vector<const uint8_t> escaped_key) {
+  if (!replacer_function_.is_null()) return false;
+  if (value->IsHeapObject()) {
+    HeapObject object = HeapObject::cast(*value);
+    if (object.IsOddball()) {
+      byte kind = Oddball::cast(object).kind();
+      // Other oddballs are skipped, along with their key.
+      if (kind != Oddball::kFalse && kind != Oddball::kTrue &&
+          kind != Oddball::kNull) {
+        return false;
+      }
+    } else if (!object.IsHeapNumber() && !object.IsString()) {
+      return false;
+    }
+  }
+  Separator(!comma);
+  builder_.AppendCharacters(escaped_key);
+  if (gap_ != nullptr) builder_.AppendCharacter(' ');
+  Result result = Serialize_<false>(value, false, factory()->empty_string());
+  DCHECK_EQ(SUCCESS, result);
+  USE(result);
+  return true;
+}
+
 JsonStringifier::Result JsonStringifier::SerializeJSReceiverSlow(
     Handle<JSReceiver> object) {
   Handle<FixedArray> contents = property_list_;
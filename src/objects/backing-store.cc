@@ -6,6 +6,7 @@
 
 #include <cstring>
 
+#include "src/base/platform/platform.h"
 #include "src/base/platform/wrappers.h"
 #include "src/execution/isolate.h"
 #include "src/handles/global-handles.h"
@@ -41,6 +42,12 @@ constexpr uint64_t kNegativeGuardSize = uint64_t{2} * GB;
 constexpr uint64_t kFullGuardSize = uint64_t{10} * GB;
 #endif
 
+// Alignment of wasm memory reservations with --wasm-huge-pages, such that the
+// committed part of the memory can be mapped with (2MiB) huge pages.
+constexpr size_t kHugePageSize = size_t{2} * MB;
+static_assert(kHugePageSize % wasm::kWasmPageSize == 0,
+              "huge pages must be aligned to wasm pages");
+
 std::atomic<uint64_t> reserved_address_space_{0};
 
 // Allocation results are reported to UMA
@@ -350,10 +357,12 @@ std::unique_ptr<BackingStore> BackingStore::TryAllocateWasmMemory(
   // 2. Allocate pages (inaccessible by default).
   //--------------------------------------------------------------------------
   void* allocation_base = nullptr;
+  size_t alignment =
+      FLAG_wasm_huge_pages ? kHugePageSize : wasm::kWasmPageSize;
   auto allocate_pages = [&] {
     allocation_base =
         AllocatePages(GetPlatformPageAllocator(), nullptr, reservation_size,
-                      wasm::kWasmPageSize, PageAllocator::kNoAccess);
+                      alignment, PageAllocator::kNoAccess);
     return allocation_base != nullptr;
   };
   if (!gc_retry(allocate_pages)) {
@@ -364,6 +373,15 @@ std::unique_ptr<BackingStore> BackingStore::TryAllocateWasmMemory(
     return {};
   }
 
+  // The advice applies to the whole reservation, so pages committed when
+  // growing the memory in place are eligible for huge pages as well. Guard
+  // regions are never committed.
+  if (FLAG_wasm_huge_pages &&
+      !base::OS::AdviseHugePages(allocation_base, reservation_size)) {
+    TRACE_BS("BSw:try   huge pages not available (%p, %zu)\n", allocation_base,
+             reservation_size);
+  }
+
   // Get a pointer to the start of the buffer, skipping negative guard region
   // if necessary.
   byte* buffer_start = reinterpret_cast<byte*>(allocation_base) +
@@ -272,23 +272,19 @@ bool JSRegExp::MarkedForTierUp() {
   return Smi::ToInt(DataAt(kIrregexpTicksUntilTierUpIndex)) == 0;
 }
 
-void JSRegExp::ResetLastTierUpTick() {
-  DCHECK(FLAG_regexp_tier_up);
-  DCHECK_EQ(TypeTag(), JSRegExp::IRREGEXP);
-  int tier_up_ticks = Smi::ToInt(DataAt(kIrregexpTicksUntilTierUpIndex)) + 1;
-  FixedArray::cast(data()).set(JSRegExp::kIrregexpTicksUntilTierUpIndex,
-                               Smi::FromInt(tier_up_ticks));
-}
-
-void JSRegExp::TierUpTick() {
+void JSRegExp::TierUpTick(int subject_length, uint32_t backtrack_count) {
   DCHECK(FLAG_regexp_tier_up);
   DCHECK_EQ(TypeTag(), JSRegExp::IRREGEXP);
   int tier_up_ticks = Smi::ToInt(DataAt(kIrregexpTicksUntilTierUpIndex));
   if (tier_up_ticks == 0) {
     return;
   }
+  uint32_t cost = 1 + subject_length / kTierUpTickSubjectLength +
+                  backtrack_count / kTierUpTickBacktracks;
+  tier_up_ticks -= static_cast<int>(
+      std::min(cost, static_cast<uint32_t>(tier_up_ticks)));
   FixedArray::cast(data()).set(JSRegExp::kIrregexpTicksUntilTierUpIndex,
-                               Smi::FromInt(tier_up_ticks - 1));
+                               Smi::FromInt(tier_up_ticks));
 }
 
 void JSRegExp::MarkTierUpForNextExec() {
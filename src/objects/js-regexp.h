@@ -89,8 +89,9 @@ class JSRegExp : public TorqueGeneratedJSRegExp<JSRegExp, JSObject> {
 
   bool CanTierUp();
   bool MarkedForTierUp();
-  void ResetLastTierUpTick();
-  void TierUpTick();
+  // Charges one execution of the bytecode, weighted by the length of the
+  // subject after the start position and the number of backtracks taken.
+  void TierUpTick(int subject_length, uint32_t backtrack_count);
   void MarkTierUpForNextExec();
 
   inline Type TypeTag() const;
@@ -188,15 +189,23 @@ class JSRegExp : public TorqueGeneratedJSRegExp<JSRegExp, JSObject> {
   // (1-based) capture group indices (at indices 2i + 1).
   static const int kIrregexpCaptureNameMapIndex = kDataIndex + 6;
   // Tier-up ticks are set to the value of the tier-up ticks flag. The value is
-  // decremented on each execution of the bytecode, so that the tier-up
-  // happens once the ticks reach zero.
+  // decremented on each execution of the bytecode by the weighted cost of that
+  // execution (see TierUpTick), so that the tier-up happens once the ticks
+  // reach zero.
   // This value is ignored if the regexp-tier-up flag isn't turned on.
   static const int kIrregexpTicksUntilTierUpIndex = kDataIndex + 7;
   // A smi containing either the backtracking limit or kNoBacktrackLimit.
   // TODO(jgruber): If needed, this limit could be packed into other fields
   // above to save space.
   static const int kIrregexpBacktrackLimit = kDataIndex + 8;
-  static const int kIrregexpDataSize = kDataIndex + 9;
+  // A string containing a literal that every match starts with, or Smi(-1)
+  // if no such prefix is known. Used to skip ahead to candidate match
+  // positions before entering the matcher.
+  static const int kIrregexpPrefilterIndex = kDataIndex + 9;
+  // A smi set to one whenever native code of the regexp is entered, and reset
+  // to zero by the RegExpCodeBudget while it looks for cold regexps.
+  static const int kIrregexpRecentlyUsedIndex = kDataIndex + 10;
+  static const int kIrregexpDataSize = kDataIndex + 11;
 
   // TODO(mbid,v8:10765): At the moment the EXPERIMENTAL data array conforms
   // to the format of an IRREGEXP data array, with most fields set to some
@@ -226,6 +235,16 @@ class JSRegExp : public TorqueGeneratedJSRegExp<JSRegExp, JSObject> {
   // tier-up to the compiler immediately, instead of using the interpreter.
   static constexpr int kTierUpForSubjectLengthValue = 1000;
 
+  // An interpreted execution costs one additional tier-up tick for every this
+  // many subject characters after the start position, and for every this many
+  // backtracks.
+  static constexpr int kTierUpTickSubjectLength = 100;
+  static constexpr uint32_t kTierUpTickBacktracks = 100;
+
+  // The heuristic value for the subject length from which generated code
+  // leaves the literal prefilter to the runtime on execs at last index 0.
+  static constexpr int kPrefilterForSubjectLengthValue = 1000;
+
   TQ_OBJECT_CONSTRUCTORS(JSRegExp)
 };
 
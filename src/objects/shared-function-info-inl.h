@@ -233,6 +233,9 @@ BIT_FIELD_ACCESSORS(SharedFunctionInfo, flags2, has_optimized_at_least_once,
 BIT_FIELD_ACCESSORS(SharedFunctionInfo, flags2, may_have_cached_code,
                     SharedFunctionInfo::MayHaveCachedCodeBit)
 
+BIT_FIELD_ACCESSORS(SharedFunctionInfo, flags2, has_flushed_bytecode,
+                    SharedFunctionInfo::HasFlushedBytecodeBit)
+
 BIT_FIELD_ACCESSORS(SharedFunctionInfo, flags, syntax_kind,
                     SharedFunctionInfo::FunctionSyntaxKindBits)
 
@@ -399,6 +399,10 @@ class SharedFunctionInfo
   // hence the 'may'.
   DECL_BOOLEAN_ACCESSORS(may_have_cached_code)
 
+  // True if the bytecode of this SFI has been flushed at least once, i.e. the
+  // function has been compiled before even if it currently isn't.
+  DECL_BOOLEAN_ACCESSORS(has_flushed_bytecode)
+
   // Returns the cached Code object for this SFI if it exists, an empty handle
   // otherwise.
   MaybeHandle<Code> TryGetCachedCode(Isolate* isolate);
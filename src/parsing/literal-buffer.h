@@ -6,6 +6,7 @@
 #define V8_PARSING_LITERAL_BUFFER_H_
 
 #include "src/strings/unicode-decoder.h"
+#include "src/utils/memcopy.h"
 #include "src/utils/vector.h"
 
 namespace v8 {
@@ -26,6 +27,15 @@ class LiteralBuffer final {
     AddOneByteChar(static_cast<byte>(code_unit));
   }
 
+  // Adds {length} ASCII code units at once.
+  template <typename Char>
+  V8_INLINE void AddAsciiChars(const Char* chars, int length) {
+    DCHECK(is_one_byte());
+    while (position_ + length > backing_store_.length()) ExpandBuffer();
+    CopyChars(&backing_store_[position_], chars, length);
+    position_ += length;
+  }
+
   V8_INLINE void AddChar(uc32 code_unit) {
     if (is_one_byte()) {
       if (code_unit <= static_cast<uc32>(unibrow::Latin1::kMaxChar)) {
@@ -0,0 +1,584 @@
+// Copyright 2021 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/parsing/parallel-preparser.h"
+
+#include <algorithm>
+#include <cstring>
+
+#include "include/v8-platform.h"
+#include "src/flags/flags.h"
+#include "src/init/v8.h"
+#include "src/objects/string-inl.h"
+#include "src/parsing/parser.h"
+#include "src/parsing/preparse-data-impl.h"
+#include "src/parsing/scanner-character-streams.h"
+#include "src/strings/char-predicates-inl.h"
+#include "src/tracing/trace-event.h"
+#include "src/utils/memcopy.h"
+
+namespace v8 {
+namespace internal {
+
+namespace {
+
+// Functions are handed to workers in batches of at least this many characters
+// of source, to amortize setting up a parser.
+constexpr int kMinBatchLength = 16 * KB;
+
+// Finds where top-level functions start, without tokenizing the source. Only
+// the lexical grammar that can hide brackets is recognized: comments, string,
+// template and regexp literals. Whether a '/' starts a regexp is guessed from
+// the previous token.
+template <typename Char>
+class TopLevelFunctionScanner {
+ public:
+  using FunctionStart = ParallelPreparser::FunctionStart;
+
+  TopLevelFunctionScanner(const Char* chars, int length)
+      : chars_(chars), length_(length) {}
+
+  bool HasUseStrictDirective();
+  std::vector<FunctionStart> FindFunctions();
+
+ private:
+  static bool IsLineTerminator(uc32 c) {
+    return c == '\n' || c == '\r' || c == 0x2028 || c == 0x2029;
+  }
+
+  static bool IsIdentifierChar(uc32 c) {
+    return IsAsciiIdentifier(c) || c == '\\' ||
+           (c > kMaxAscii && !IsWhiteSpaceOrLineTerminator(c));
+  }
+
+  bool Matches(int start, int end, const char* word) const {
+    for (int i = start; i < end; i++, word++) {
+      if (*word == '\0' || chars_[i] != static_cast<Char>(*word)) return false;
+    }
+    return *word == '\0';
+  }
+
+  // Whether a line starting with {c} continues the expression on the previous
+  // line, i.e. no semicolon is inserted in between.
+  static bool ContinuesExpression(uc32 c) {
+    return c != '\0' && c <= kMaxAscii &&
+           strchr("([.+-*/%,?=<>&|^`", static_cast<char>(c)) != nullptr;
+  }
+
+  // Keywords after which a '/' starts a regexp.
+  bool IsKeywordBeforeExpression(int start, int end) const {
+    static const char* const kKeywords[] = {
+        "return", "typeof", "instanceof", "in",   "of",    "new",  "delete",
+        "void",   "throw",  "case",       "do",   "else",  "yield", "await"};
+    for (const char* keyword : kKeywords) {
+      if (Matches(start, end, keyword)) return true;
+    }
+    return false;
+  }
+
+  // Advances past whitespace and comments, and returns whether that included
+  // a line terminator.
+  bool SkipTrivia(int* position) const;
+  int SkipIdentifier(int position) const {
+    while (position < length_ && IsIdentifierChar(chars_[position])) {
+      if (chars_[position] == '\\') position++;
+      position++;
+    }
+    return position;
+  }
+  void SkipString(Char quote);
+  void SkipRegExp();
+  // Advances past a template span, and returns true if it ends with a
+  // substitution rather than the end of the template.
+  bool SkipTemplateSpan();
+  void MaybeAddFunction(bool is_async, std::vector<FunctionStart>* functions);
+
+  const Char* const chars_;
+  const int length_;
+  int position_ = 0;
+};
+
+template <typename Char>
+bool TopLevelFunctionScanner<Char>::SkipTrivia(int* position) const {
+  bool line_terminator = false;
+  int pos = *position;
+  while (pos < length_) {
+    uc32 c = chars_[pos];
+    if (IsLineTerminator(c)) {
+      line_terminator = true;
+      pos++;
+    } else if (IsWhiteSpace(c)) {
+      pos++;
+    } else if (c == '/' && pos + 1 < length_ && chars_[pos + 1] == '/') {
+      while (pos < length_ && !IsLineTerminator(chars_[pos])) pos++;
+    } else if (c == '/' && pos + 1 < length_ && chars_[pos + 1] == '*') {
+      pos += 2;
+      while (pos < length_ &&
+             !(chars_[pos] == '*' && pos + 1 < length_ &&
+               chars_[pos + 1] == '/')) {
+        if (IsLineTerminator(chars_[pos])) line_terminator = true;
+        pos++;
+      }
+      pos = std::min(pos + 2, length_);
+    } else {
+      break;
+    }
+  }
+  *position = pos;
+  return line_terminator;
+}
+
+template <typename Char>
+void TopLevelFunctionScanner<Char>::SkipString(Char quote) {
+  DCHECK_EQ(quote, chars_[position_]);
+  position_++;
+  while (position_ < length_) {
+    Char c = chars_[position_++];
+    if (c == quote) return;
+    if (c == '\\') {
+      position_++;
+    } else if (c == '\n' || c == '\r') {
+      return;
+    }
+  }
+}
+
+template <typename Char>
+void TopLevelFunctionScanner<Char>::SkipRegExp() {
+  DCHECK_EQ('/', chars_[position_]);
+  position_++;
+  bool in_class = false;
+  while (position_ < length_) {
+    Char c = chars_[position_++];
+    if (c == '\\') {
+      position_++;
+    } else if (IsLineTerminator(c)) {
+      return;
+    } else if (in_class) {
+      if (c == ']') in_class = false;
+    } else if (c == '[') {
+      in_class = true;
+    } else if (c == '/') {
+      break;
+    }
+  }
+  position_ = SkipIdentifier(position_);
+}
+
+template <typename Char>
+bool TopLevelFunctionScanner<Char>::SkipTemplateSpan() {
+  while (position_ < length_) {
+    Char c = chars_[position_++];
+    if (c == '\\') {
+      position_++;
+    } else if (c == '`') {
+      return false;
+    } else if (c == '$' && position_ < length_ && chars_[position_] == '{') {
+      position_++;
+      return true;
+    }
+  }
+  return false;
+}
+
+template <typename Char>
+bool TopLevelFunctionScanner<Char>::HasUseStrictDirective() {
+  int pos = 0;
+  while (true) {
+    SkipTrivia(&pos);
+    if (pos == length_ || (chars_[pos] != '"' && chars_[pos] != '\'')) {
+      return false;
+    }
+    position_ = pos;
+    SkipString(chars_[pos]);
+    bool use_strict = Matches(pos + 1, position_ - 1, "use strict");
+    pos = position_;
+    // The string literal is a directive if it is a statement on its own.
+    bool line_terminator = SkipTrivia(&pos);
+    if (pos < length_ && chars_[pos] == ';') {
+      pos++;
+    } else if (pos < length_ && chars_[pos] != '}' &&
+               (!line_terminator || ContinuesExpression(chars_[pos]))) {
+      return false;
+    }
+    if (use_strict) return true;
+  }
+}
+
+template <typename Char>
+void TopLevelFunctionScanner<Char>::MaybeAddFunction(
+    bool is_async, std::vector<FunctionStart>* functions) {
+  // Look for `function [*] [name] (`.
+  int pos = position_;
+  SkipTrivia(&pos);
+  bool is_generator = pos < length_ && chars_[pos] == '*';
+  if (is_generator) {
+    pos++;
+    SkipTrivia(&pos);
+  }
+  if (pos < length_ && IsIdentifierChar(chars_[pos]) &&
+      !IsDecimalDigit(chars_[pos])) {
+    pos = SkipIdentifier(pos);
+    SkipTrivia(&pos);
+  }
+  if (pos == length_ || chars_[pos] != '(') return;
+  FunctionKind kind =
+      is_async ? (is_generator ? FunctionKind::kAsyncGeneratorFunction
+                               : FunctionKind::kAsyncFunction)
+               : (is_generator ? FunctionKind::kGeneratorFunction
+                               : FunctionKind::kNormalFunction);
+  functions->push_back({pos, kind});
+}
+
+template <typename Char>
+std::vector<ParallelPreparser::FunctionStart>
+TopLevelFunctionScanner<Char>::FindFunctions() {
+  std::vector<FunctionStart> functions;
+  // The bracket depths at which template substitutions started.
+  std::vector<int> template_depths;
+  int depth = 0;
+  bool regexp_allowed = true;
+  bool after_dot = false;
+  bool after_async = false;
+  position_ = 0;
+  while (position_ < length_ && depth >= 0) {
+    if (SkipTrivia(&position_)) after_async = false;
+    if (position_ == length_) break;
+    Char c = chars_[position_];
+    bool is_dot = false;
+    bool is_async = false;
+    switch (c) {
+      case '/':
+        if (regexp_allowed) {
+          SkipRegExp();
+          regexp_allowed = false;
+        } else {
+          position_++;
+          regexp_allowed = true;
+        }
+        break;
+      case '\'':
+      case '"':
+        SkipString(c);
+        regexp_allowed = false;
+        break;
+      case '`':
+        position_++;
+        if (SkipTemplateSpan()) {
+          template_depths.push_back(depth++);
+          regexp_allowed = true;
+        } else {
+          regexp_allowed = false;
+        }
+        break;
+      case '(':
+      case '[':
+      case '{':
+        position_++;
+        depth++;
+        regexp_allowed = true;
+        break;
+      case ')':
+      case ']':
+        position_++;
+        depth--;
+        regexp_allowed = false;
+        break;
+      case '}':
+        position_++;
+        depth--;
+        regexp_allowed = true;
+        if (!template_depths.empty() && template_depths.back() == depth) {
+          template_depths.pop_back();
+          if (SkipTemplateSpan()) {
+            template_depths.push_back(depth++);
+          } else {
+            regexp_allowed = false;
+          }
+        }
+        break;
+      case '.':
+        position_++;
+        if (position_ < length_ && IsDecimalDigit(chars_[position_])) {
+          position_ = SkipIdentifier(position_);
+          regexp_allowed = false;
+        } else {
+          is_dot = true;
+          regexp_allowed = true;
+        }
+        break;
+      default:
+        if (IsDecimalDigit(c)) {
+          // Numbers, including exponents and separators, but not signs.
+          while (position_ < length_ && (IsAlphaNumeric(chars_[position_]) ||
+                                         chars_[position_] == '_' ||
+                                         chars_[position_] == '.')) {
+            position_++;
+          }
+          regexp_allowed = false;
+        } else if (IsIdentifierChar(c)) {
+          int start = position_;
+          position_ = SkipIdentifier(position_);
+          if (after_dot) {
+            // A property name.
+            regexp_allowed = false;
+          } else if (Matches(start, position_, "function")) {
+            if (depth == 0) MaybeAddFunction(after_async, &functions);
+            regexp_allowed = false;
+          } else {
+            is_async = Matches(start, position_, "async");
+            regexp_allowed = IsKeywordBeforeExpression(start, position_);
+          }
+        } else {
+          position_++;
+          regexp_allowed = true;
+        }
+        break;
+    }
+    after_dot = is_dot;
+    after_async = is_async;
+  }
+  return functions;
+}
+
+}  // namespace
+
+// static
+template <typename Char>
+std::vector<ParallelPreparser::FunctionStart>
+ParallelPreparser::FindTopLevelFunctions(const Char* chars, int length,
+                                         LanguageMode* language_mode) {
+  TopLevelFunctionScanner<Char> scanner(chars, length);
+  if (scanner.HasUseStrictDirective()) *language_mode = LanguageMode::kStrict;
+  return scanner.FindFunctions();
+}
+
+template V8_EXPORT_PRIVATE std::vector<ParallelPreparser::FunctionStart>
+ParallelPreparser::FindTopLevelFunctions(const uint8_t* chars, int length,
+                                         LanguageMode* language_mode);
+template V8_EXPORT_PRIVATE std::vector<ParallelPreparser::FunctionStart>
+ParallelPreparser::FindTopLevelFunctions(const uint16_t* chars, int length,
+                                         LanguageMode* language_mode);
+
+class ParallelPreparser::PreparseJob final : public JobTask {
+ public:
+  explicit PreparseJob(ParallelPreparser* preparser) : preparser_(preparser) {}
+
+  void Run(JobDelegate* delegate) final {
+    while (!delegate->ShouldYield()) {
+      Batch* batch = preparser_->ClaimBatch();
+      if (batch == nullptr) return;
+      preparser_->PreparseBatch(batch);
+    }
+  }
+
+  size_t GetMaxConcurrency(size_t worker_count) const final {
+    return preparser_->RemainingBatches();
+  }
+
+ private:
+  ParallelPreparser* const preparser_;
+};
+
+// static
+std::unique_ptr<ParallelPreparser> ParallelPreparser::For(
+    Isolate* isolate, ParseInfo* info, Handle<String> source) {
+  const UnoptimizedCompileFlags& flags = info->flags();
+  if (!FLAG_parallel_preparse ||
+      source->length() < FLAG_parallel_preparse_min_size * KB) {
+    return nullptr;
+  }
+  // Only functions in a script's scope can be preparsed independently of
+  // their surroundings.
+  DCHECK(flags.is_toplevel());
+  if (flags.is_eval() || flags.is_module() || flags.is_repl_mode() ||
+      info->is_wrapped_as_function() || info->extension() != nullptr ||
+      !flags.allow_lazy_parsing() || !flags.allow_lazy_compile() ||
+      flags.is_eager()) {
+    return nullptr;
+  }
+  if (V8::GetCurrentPlatform()->NumberOfWorkerThreads() == 0) return nullptr;
+
+  std::unique_ptr<ParallelPreparser> preparser(
+      new ParallelPreparser(info, flags.outer_language_mode()));
+  source = String::Flatten(isolate, source);
+  int length = source->length();
+  {
+    DisallowGarbageCollection no_gc;
+    String::FlatContent content = source->GetFlatContent(no_gc);
+    if (content.IsOneByte()) {
+      preparser->one_byte_source_.reset(new uint8_t[length]);
+      CopyChars(preparser->one_byte_source_.get(),
+                content.ToOneByteVector().begin(), length);
+    } else {
+      preparser->two_byte_source_.reset(new uint16_t[length]);
+      CopyChars(preparser->two_byte_source_.get(),
+                content.ToUC16Vector().begin(), length);
+    }
+  }
+  if (preparser->one_byte_source_) {
+    preparser->Initialize(preparser->one_byte_source_.get(), length);
+  } else {
+    preparser->Initialize(preparser->two_byte_source_.get(), length);
+  }
+  // With a single batch, the parser would mostly wait for the worker.
+  if (preparser->batches_.size() < 2) return nullptr;
+  preparser->Start();
+  return preparser;
+}
+
+ParallelPreparser::ParallelPreparser(const ParseInfo* info,
+                                     LanguageMode language_mode)
+    : flags_(info->flags()),
+      compile_state_(*info->state()),
+      language_mode_(language_mode) {}
+
+ParallelPreparser::~ParallelPreparser() {
+  if (job_handle_ && job_handle_->IsValid()) job_handle_->Cancel();
+}
+
+template <typename Char>
+void ParallelPreparser::Initialize(const Char* chars, int length) {
+  source_length_ = length;
+  std::vector<FunctionStart> starts =
+      FindTopLevelFunctions(chars, length, &language_mode_);
+  functions_.reserve(starts.size());
+  for (const FunctionStart& start : starts) {
+    functions_.push_back({start});
+  }
+  int begin = 0;
+  for (int i = 1; i <= static_cast<int>(functions_.size()); i++) {
+    int end_position = i < static_cast<int>(functions_.size())
+                           ? functions_[i].start.position
+                           : length;
+    if (end_position - functions_[begin].start.position < kMinBatchLength &&
+        i < static_cast<int>(functions_.size())) {
+      continue;
+    }
+    batches_.push_back({begin, i});
+    begin = i;
+  }
+}
+
+void ParallelPreparser::Start() {
+  job_handle_ = V8::GetCurrentPlatform()->PostJob(
+      TaskPriority::kUserBlocking, std::make_unique<PreparseJob>(this));
+}
+
+ParallelPreparser::Batch* ParallelPreparser::ClaimBatch() {
+  base::MutexGuard guard(&mutex_);
+  while (next_batch_.load(std::memory_order_relaxed) < batches_.size()) {
+    Batch* batch =
+        &batches_[next_batch_.fetch_add(1, std::memory_order_relaxed)];
+    if (batch->state == BatchState::kPending) {
+      batch->state = BatchState::kRunning;
+      return batch;
+    }
+  }
+  return nullptr;
+}
+
+size_t ParallelPreparser::RemainingBatches() const {
+  // Batches taken by the parser are still counted, but the job only needs an
+  // estimate.
+  return batches_.size() -
+         std::min(batches_.size(), next_batch_.load(std::memory_order_relaxed));
+}
+
+void ParallelPreparser::PreparseBatch(Batch* batch) {
+  TRACE_EVENT0(TRACE_DISABLED_BY_DEFAULT("v8.compile"),
+               "V8.ParallelPreparseBatch");
+  batch->compile_state =
+      std::make_unique<UnoptimizedCompileState>(compile_state_);
+  batch->info =
+      ParseInfo::ForParallelPreparse(flags_, batch->compile_state.get());
+  batch->info->SetPerThreadState(
+      GetCurrentStackPosition() - FLAG_stack_size * KB, nullptr);
+  batch->info->set_character_stream(
+      one_byte_source_
+          ? ScannerStream::ForArray(one_byte_source_.get(), source_length_)
+          : ScannerStream::ForArray(two_byte_source_.get(), source_length_));
+
+  {
+    // The parser has to be gone before the batch is marked done, since
+    // TakeResult may then free the ParseInfo it uses.
+    Parser parser(batch->info.get());
+    bool failed = false;
+    for (int i = batch->begin; i < batch->end; i++) {
+      PreparsedFunction result;
+      if (!failed) {
+        failed = !parser.PreparseTopLevelFunction(functions_[i].start.position,
+                                                  functions_[i].start.kind,
+                                                  language_mode_, &result);
+      }
+      base::MutexGuard guard(&mutex_);
+      if (failed) {
+        functions_[i].state = FunctionState::kFailed;
+      } else {
+        functions_[i].state = FunctionState::kDone;
+        functions_[i].result = result;
+      }
+      function_done_.NotifyAll();
+    }
+  }
+  base::MutexGuard guard(&mutex_);
+  batch->state = BatchState::kDone;
+}
+
+namespace {
+
+ZonePreparseData* CopyPreparseData(ZonePreparseData* data, Zone* zone) {
+  Vector<uint8_t> bytes(data->byte_data()->data(), data->byte_data()->size());
+  ZonePreparseData* copy =
+      zone->New<ZonePreparseData>(zone, &bytes, data->children_length());
+  for (int i = 0; i < data->children_length(); i++) {
+    copy->set_child(i, CopyPreparseData(data->get_child(i), zone));
+  }
+  return copy;
+}
+
+}  // namespace
+
+bool ParallelPreparser::TakeResult(int position, FunctionKind kind,
+                                   LanguageMode language_mode, Zone* zone,
+                                   PreparsedFunction* result) {
+  auto it = std::lower_bound(functions_.begin(), functions_.end(), position,
+                             [](const Function& function, int value) {
+                               return function.start.position < value;
+                             });
+  if (it == functions_.end() || it->start.position != position ||
+      it->start.kind != kind || language_mode != language_mode_) {
+    return false;
+  }
+  int index = static_cast<int>(it - functions_.begin());
+  auto batch = std::upper_bound(
+      batches_.begin(), batches_.end(), index,
+      [](int value, const Batch& other) { return value < other.begin; });
+  DCHECK(batch != batches_.begin());
+  --batch;
+  DCHECK_LT(index, batch->end);
+
+  base::MutexGuard guard(&mutex_);
+  if (batch->state == BatchState::kPending) {
+    // Nobody has started on this batch yet; the parser gets to it first.
+    batch->state = BatchState::kTakenByParser;
+  }
+  if (batch->state == BatchState::kTakenByParser) return false;
+  while (it->state == FunctionState::kPending) function_done_.Wait(&mutex_);
+  if (it->state == FunctionState::kFailed) return false;
+
+  *result = it->result;
+  if (result->preparse_data != nullptr) {
+    result->preparse_data = CopyPreparseData(result->preparse_data, zone);
+  }
+  if (index == batch->end - 1 && batch->state == BatchState::kDone) {
+    // The rest of the batch has been skipped over by now.
+    batch->info.reset();
+    batch->compile_state.reset();
+  }
+  return true;
+}
+
+}  // namespace internal
+}  // namespace v8
@@ -0,0 +1,145 @@
+// Copyright 2021 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_PARSING_PARALLEL_PREPARSER_H_
+#define V8_PARSING_PARALLEL_PREPARSER_H_
+
+#include <atomic>
+#include <bitset>
+#include <memory>
+#include <vector>
+
+#include "include/v8.h"
+#include "src/base/platform/condition-variable.h"
+#include "src/base/platform/mutex.h"
+#include "src/common/globals.h"
+#include "src/handles/handles.h"
+#include "src/objects/function-kind.h"
+#include "src/parsing/parse-info.h"
+
+namespace v8 {
+
+class JobHandle;
+
+namespace internal {
+
+class String;
+class Zone;
+class ZonePreparseData;
+
+// What the parser needs to know about a preparsed top-level function in order
+// to skip it, i.e. what it would have learned by preparsing it itself.
+struct PreparsedFunction {
+  int end_position = kNoSourcePosition;
+  int num_parameters = -1;
+  int function_length = -1;
+  int num_inner_functions = 0;
+  LanguageMode language_mode = LanguageMode::kSloppy;
+  bool inner_scope_calls_eval = false;
+  std::bitset<v8::Isolate::kUseCounterFeatureCount> use_counts;
+  ZonePreparseData* preparse_data = nullptr;
+};
+
+// Preparses the top-level functions of a large script on worker threads while
+// the main thread parses the script (see --parallel-preparse).
+//
+// A quick scan of the source, which only keeps track of brackets, comments,
+// string, template and regexp literals, finds where top-level functions start.
+// These functions are preparsed in batches by a job; when the parser reaches
+// one of them, it takes the result instead of preparsing the function itself,
+// or preparses the rest of the batch itself if no worker has started on it
+// yet. The quick scan may be wrong on unusual code; the parser only uses
+// results for functions that it also considers to be top-level functions, so
+// this can only cost some wasted work.
+class V8_EXPORT_PRIVATE ParallelPreparser final {
+ public:
+  struct FunctionStart {
+    // The position of the opening parenthesis of the parameters.
+    int position;
+    FunctionKind kind;
+    bool operator==(const FunctionStart& other) const {
+      return position == other.position && kind == other.kind;
+    }
+  };
+
+  // Returns a ParallelPreparser for the script {source}, or nullptr if it
+  // isn't worth preparsing it in parallel.
+  static std::unique_ptr<ParallelPreparser> For(Isolate* isolate,
+                                                ParseInfo* info,
+                                                Handle<String> source);
+
+  ~ParallelPreparser();
+  ParallelPreparser(const ParallelPreparser&) = delete;
+  ParallelPreparser& operator=(const ParallelPreparser&) = delete;
+
+  // Returns true and fills in {result} if the top-level function declaration
+  // whose parameters start at {position} has been preparsed as a function of
+  // the given kind and initial language mode, copying its preparse data into
+  // {zone}. May wait for a worker that is preparsing the function.
+  bool TakeResult(int position, FunctionKind kind, LanguageMode language_mode,
+                  Zone* zone, PreparsedFunction* result);
+
+  // Finds the top-level function declarations and anonymous function
+  // expressions in {chars}. Also sets {language_mode} to strict if the
+  // script starts with a "use strict" directive.
+  template <typename Char>
+  static std::vector<FunctionStart> FindTopLevelFunctions(
+      const Char* chars, int length, LanguageMode* language_mode);
+
+ private:
+  class PreparseJob;
+
+  enum class FunctionState { kPending, kDone, kFailed };
+  enum class BatchState { kPending, kRunning, kDone, kTakenByParser };
+
+  struct Function {
+    FunctionStart start;
+    FunctionState state = FunctionState::kPending;
+    PreparsedFunction result;
+  };
+
+  struct Batch {
+    int begin;
+    int end;
+    BatchState state = BatchState::kPending;
+    // Own the preparse data of the batch's functions until they are taken.
+    std::unique_ptr<UnoptimizedCompileState> compile_state;
+    std::unique_ptr<ParseInfo> info;
+  };
+
+  ParallelPreparser(const ParseInfo* info, LanguageMode language_mode);
+
+  template <typename Char>
+  void Initialize(const Char* chars, int length);
+  void Start();
+
+  // Called on worker threads.
+  Batch* ClaimBatch();
+  void PreparseBatch(Batch* batch);
+  size_t RemainingBatches() const;
+
+  const UnoptimizedCompileFlags flags_;
+  UnoptimizedCompileState compile_state_;
+  LanguageMode language_mode_;
+
+  // A copy of the source, which the workers scan.
+  std::unique_ptr<uint8_t[]> one_byte_source_;
+  std::unique_ptr<uint16_t[]> two_byte_source_;
+  int source_length_ = 0;
+
+  // Sorted by position.
+  std::vector<Function> functions_;
+  std::vector<Batch> batches_;
+
+  base::Mutex mutex_;
+  base::ConditionVariable function_done_;
+  // Only incremented under {mutex_}.
+  std::atomic<size_t> next_batch_{0};
+  std::unique_ptr<JobHandle> job_handle_;
+};
+
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_PARSING_PARALLEL_PREPARSER_H_
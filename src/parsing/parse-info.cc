@@ -227,6 +227,14 @@ std::unique_ptr<ParseInfo> ParseInfo::ForToplevelFunction(
   return result;
 }
 
+// static
+std::unique_ptr<ParseInfo> ParseInfo::ForParallelPreparse(
+    const UnoptimizedCompileFlags flags,
+    UnoptimizedCompileState* compile_state) {
+  DCHECK(flags.is_toplevel());
+  return std::unique_ptr<ParseInfo>(new ParseInfo(flags, compile_state));
+}
+
 ParseInfo::~ParseInfo() = default;
 
 DeclarationScope* ParseInfo::scope() const { return literal()->scope(); }
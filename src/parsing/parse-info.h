@@ -211,6 +211,12 @@ class V8_EXPORT_PRIVATE ParseInfo {
       UnoptimizedCompileState* compile_state, const FunctionLiteral* literal,
       const AstRawString* function_name);
 
+  // Creates a new parse info for preparsing the top-level functions of a
+  // script compiled with |flags| on a worker thread (see ParallelPreparser).
+  static std::unique_ptr<ParseInfo> ForParallelPreparse(
+      const UnoptimizedCompileFlags flags,
+      UnoptimizedCompileState* compile_state);
+
   ~ParseInfo();
 
   template <typename LocalIsolate>
@@ -22,6 +22,7 @@
 #include "src/logging/log.h"
 #include "src/numbers/conversions-inl.h"
 #include "src/objects/scope-info.h"
+#include "src/parsing/parallel-preparser.h"
 #include "src/parsing/parse-info.h"
 #include "src/parsing/rewriter.h"
 #include "src/runtime/runtime.h"
@@ -2735,6 +2736,16 @@ bool Parser::SkipFunction(const AstRawString* function_name, FunctionKind kind,
     return true;
   }
 
+  if (parallel_preparser_ != nullptr &&
+      (function_syntax_kind == FunctionSyntaxKind::kDeclaration ||
+       function_syntax_kind == FunctionSyntaxKind::kAnonymousExpression) &&
+      function_scope->outer_scope()->is_script_scope() &&
+      !MaybeParsingArrowhead() &&
+      SkipPreparsedFunction(kind, function_scope, num_parameters,
+                            function_length, produced_preparse_data)) {
+    return true;
+  }
+
   Scanner::BookmarkScope bookmark(scanner());
   bookmark.Set(function_scope->start_position());
 
@@ -2798,6 +2809,92 @@ bool Parser::SkipFunction(const AstRawString* function_name, FunctionKind kind,
   return true;
 }
 
+bool Parser::SkipPreparsedFunction(
+    FunctionKind kind, DeclarationScope* function_scope, int* num_parameters,
+    int* function_length, ProducedPreparseData** produced_preparse_data) {
+  PreparsedFunction result;
+  if (!parallel_preparser_->TakeResult(function_scope->start_position(), kind,
+                                       function_scope->language_mode(),
+                                       main_zone(), &result)) {
+    return false;
+  }
+
+  // Replay what preparsing the function would have done to the parser state.
+  function_scope->set_end_position(result.end_position);
+  scanner()->SeekForward(result.end_position - 1);
+  Expect(Token::RBRACE);
+  function_scope->SetLanguageMode(result.language_mode);
+  // The function's scope is discarded, only the outer scopes need to know.
+  if (result.inner_scope_calls_eval) {
+    function_scope->RecordInnerScopeEvalCall();
+  }
+  total_preparse_skipped_ +=
+      function_scope->end_position() - function_scope->start_position();
+  *num_parameters = result.num_parameters;
+  *function_length = result.function_length;
+  SkipFunctionLiterals(result.num_inner_functions);
+  for (int feature = 0; feature < v8::Isolate::kUseCounterFeatureCount;
+       ++feature) {
+    if (result.use_counts[feature]) ++use_counts_[feature];
+  }
+  *produced_preparse_data =
+      result.preparse_data == nullptr
+          ? nullptr
+          : ProducedPreparseData::For(result.preparse_data, main_zone());
+  function_scope->ResetAfterPreparsing(ast_value_factory_, false);
+  return true;
+}
+
+bool Parser::PreparseTopLevelFunction(int position, FunctionKind kind,
+                                      LanguageMode language_mode,
+                                      PreparsedFunction* result) {
+  parsing_on_main_thread_ = false;
+  if (original_scope_ == nullptr) {
+    InitializeEmptyScopeChain(info_);
+    scanner_.Initialize();
+  }
+  DCHECK(!has_error());
+  scanner_.SeekNext(position);
+
+  ParsingModeScope mode(this, PARSE_LAZILY);
+  DeclarationScope* script_scope = original_scope_->AsDeclarationScope();
+  FunctionState function_state(&function_state_, &scope_, script_scope);
+  DeclarationScope* scope = NewFunctionScope(kind, &preparser_zone_);
+  scope->SetLanguageMode(language_mode);
+  Consume(Token::LPAREN);
+  scope->set_start_position(position);
+
+  for (int feature = 0; feature < v8::Isolate::kUseCounterFeatureCount;
+       ++feature) {
+    use_counts_[feature] = 0;
+  }
+  int num_parameters = -1;
+  int function_length = -1;
+  ProducedPreparseData* produced_preparse_data = nullptr;
+  if (!SkipFunction(ast_value_factory()->empty_string(), kind,
+                    FunctionSyntaxKind::kDeclaration, scope, &num_parameters,
+                    &function_length, &produced_preparse_data) ||
+      has_error()) {
+    return false;
+  }
+
+  PreParserLogger* logger = reusable_preparser()->logger();
+  result->end_position = scope->end_position();
+  result->num_parameters = num_parameters;
+  result->function_length = function_length;
+  result->num_inner_functions = logger->num_inner_functions();
+  result->language_mode = scope->language_mode();
+  result->inner_scope_calls_eval = scope->inner_scope_calls_eval();
+  for (int feature = 0; feature < v8::Isolate::kUseCounterFeatureCount;
+       ++feature) {
+    result->use_counts[feature] = use_counts_[feature] > 0;
+  }
+  result->preparse_data = produced_preparse_data == nullptr
+                              ? nullptr
+                              : produced_preparse_data->Serialize(zone());
+  return true;
+}
+
 Block* Parser::BuildParameterInitializationBlock(
     const ParserFormalParameters& parameters) {
   DCHECK(!parameters.is_simple);
@@ -29,11 +29,13 @@ class ScriptCompiler;
 namespace internal {
 
 class ConsumedPreparseData;
+class ParallelPreparser;
 class ParseInfo;
 class ParserTarget;
 class ParserTargetScope;
 class PendingCompilationErrorHandler;
 class PreparseData;
+struct PreparsedFunction;
 
 // ----------------------------------------------------------------------------
 // JAVASCRIPT PARSING
@@ -140,6 +142,20 @@ class V8_EXPORT_PRIVATE Parser : public NON_EXPORTED_BASE(ParserBase<Parser>) {
   void ParseOnBackground(ParseInfo* info, int start_position, int end_position,
                          int function_literal_id);
 
+  // Preparses the top-level function of the given kind whose parameters start
+  // at |position|, on a worker thread for a ParallelPreparser. Returns false
+  // if the function couldn't be preparsed; the parser can't be used for
+  // further functions in that case.
+  bool PreparseTopLevelFunction(int position, FunctionKind kind,
+                                LanguageMode language_mode,
+                                PreparsedFunction* result);
+
+  // Top-level functions are skipped using the results of |parallel_preparser|
+  // where possible.
+  void set_parallel_preparser(ParallelPreparser* parallel_preparser) {
+    parallel_preparser_ = parallel_preparser;
+  }
+
   // Initializes an empty scope chain for top-level scripts, or scopes which
   // consist of only the native context.
   void InitializeEmptyScopeChain(ParseInfo* info);
@@ -428,6 +444,12 @@ class V8_EXPORT_PRIVATE Parser : public NON_EXPORTED_BASE(ParserBase<Parser>) {
                     DeclarationScope* function_scope, int* num_parameters,
                     int* function_length,
                     ProducedPreparseData** produced_preparsed_scope_data);
+  // Skips over a top-level function preparsed by the parallel preparser, if
+  // its result is available. Consumes the ending }.
+  bool SkipPreparsedFunction(FunctionKind kind,
+                             DeclarationScope* function_scope,
+                             int* num_parameters, int* function_length,
+                             ProducedPreparseData** produced_preparse_data);
 
   Block* BuildParameterInitializationBlock(
       const ParserFormalParameters& parameters);
@@ -1079,6 +1101,7 @@ class V8_EXPORT_PRIVATE Parser : public NON_EXPORTED_BASE(ParserBase<Parser>) {
   bool allow_lazy_;
   bool temp_zoned_;
   ConsumedPreparseData* consumed_preparse_data_;
+  ParallelPreparser* parallel_preparser_ = nullptr;
   std::vector<uint8_t> preparse_data_buffer_;
 
   // If not kNoSourcePosition, indicates that the first function literal
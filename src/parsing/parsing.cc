@@ -11,6 +11,7 @@
 #include "src/execution/vm-state-inl.h"
 #include "src/handles/maybe-handles.h"
 #include "src/objects/objects-inl.h"
+#include "src/parsing/parallel-preparser.h"
 #include "src/parsing/parse-info.h"
 #include "src/parsing/parser.h"
 #include "src/parsing/rewriter.h"
@@ -51,8 +52,11 @@ bool ParseProgram(ParseInfo* info, Handle<Script> script,
   std::unique_ptr<Utf16CharacterStream> stream(
       ScannerStream::For(isolate, source));
   info->set_character_stream(std::move(stream));
+  std::unique_ptr<ParallelPreparser> parallel_preparser =
+      ParallelPreparser::For(isolate, info, source);
 
   Parser parser(info);
+  parser.set_parallel_preparser(parallel_preparser.get());
 
   // Ok to use Isolate here; this function is only called in the main thread.
   DCHECK(parser.parsing_on_main_thread_);
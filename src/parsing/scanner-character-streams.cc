@@ -83,6 +83,7 @@ class OnHeapStream {
 
   static const bool kCanBeCloned = false;
   static const bool kCanAccessHeap = true;
+  static const bool kIsContiguous = true;
 
  private:
   Handle<String> string_;
@@ -117,6 +118,7 @@ class ExternalStringStream {
 
   static const bool kCanBeCloned = true;
   static const bool kCanAccessHeap = false;
+  static const bool kIsContiguous = true;
 
  private:
   ScopedExternalStringLock lock_;
@@ -124,11 +126,11 @@ class ExternalStringStream {
   const size_t length_;
 };
 
-// A Char stream backed by a C array. Testing only.
+// A Char stream backed by an off-heap array, which outlives the stream.
 template <typename Char>
-class TestingStream {
+class ArrayStream {
  public:
-  TestingStream(const Char* data, size_t length)
+  ArrayStream(const Char* data, size_t length)
       : data_(data), length_(length) {}
   // The no_gc argument is only here because of the templated way this class
   // is used along with other implementations that require V8 heap access.
@@ -139,6 +141,7 @@ class TestingStream {
 
   static const bool kCanBeCloned = true;
   static const bool kCanAccessHeap = false;
+  static const bool kIsContiguous = true;
 
  private:
   const Char* const data_;
@@ -173,6 +176,7 @@ class ChunkedStream {
 
   static const bool kCanBeCloned = false;
   static const bool kCanAccessHeap = false;
+  static const bool kIsContiguous = false;
 
  private:
   struct Chunk {
@@ -237,6 +241,7 @@ class BufferedCharacterStream : public Utf16CharacterStream {
   template <class... TArgs>
   BufferedCharacterStream(size_t pos, TArgs... args) : byte_stream_(args...) {
     buffer_pos_ = pos;
+    InitializeOneByteSource();
   }
 
   bool can_be_cloned() const final {
@@ -276,7 +281,21 @@ class BufferedCharacterStream : public Utf16CharacterStream {
 
  private:
   BufferedCharacterStream(const BufferedCharacterStream<ByteStream>& other)
-      : byte_stream_(other.byte_stream_) {}
+      : byte_stream_(other.byte_stream_) {
+    InitializeOneByteSource();
+  }
+
+  // Lets the scanner skip over long runs of characters in off-heap sources
+  // without widening them into the buffer first.
+  void InitializeOneByteSource() {
+    if (ByteStream<uint8_t>::kCanAccessHeap ||
+        !ByteStream<uint8_t>::kIsContiguous) {
+      return;
+    }
+    Range<uint8_t> range = byte_stream_.GetDataAt(0, nullptr, nullptr);
+    one_byte_start_ = range.start;
+    one_byte_end_ = range.end;
+  }
 
   static const size_t kBufferSize = 512;
   uc16 buffer_[kBufferSize];
@@ -592,8 +611,15 @@ void Utf8ExternalStreamingStream::FillBufferFromCurrentChunk() {
 
   const uint16_t* max_buffer_end = buffer_start_ + kBufferSize;
   while (cursor < end && output_cursor + 1 < max_buffer_end) {
-    unibrow::uchar t =
-        unibrow::Utf8::ValueOfIncremental(&cursor, &state, &incomplete_char);
+    unibrow::uchar t = unibrow::Utf8::kIncomplete;
+    // Fast path for complete two and three byte sequences.
+    if (state == unibrow::Utf8::State::kAccept &&
+        *cursor > unibrow::Utf8::kMaxOneByteChar) {
+      t = unibrow::Utf8::ValueOfTwoOrThreeByteSequence(&cursor, end);
+    }
+    if (t == unibrow::Utf8::kIncomplete) {
+      t = unibrow::Utf8::ValueOfIncremental(&cursor, &state, &incomplete_char);
+    }
     if (V8_LIKELY(t <= unibrow::Utf16::kMaxNonSurrogateCharCode)) {
       *(output_cursor++) = static_cast<uc16>(t);  // The most frequent case.
     } else if (t == unibrow::Utf8::kIncomplete) {
@@ -790,6 +816,18 @@ std::unique_ptr<Utf16CharacterStream> ScannerStream::ForTesting(
   return ScannerStream::ForTesting(data, strlen(data));
 }
 
+std::unique_ptr<Utf16CharacterStream> ScannerStream::ForArray(
+    const uint8_t* data, size_t length) {
+  return std::unique_ptr<Utf16CharacterStream>(
+      new BufferedCharacterStream<ArrayStream>(0, data, length));
+}
+
+std::unique_ptr<Utf16CharacterStream> ScannerStream::ForArray(
+    const uint16_t* data, size_t length) {
+  return std::unique_ptr<Utf16CharacterStream>(
+      new UnbufferedCharacterStream<ArrayStream>(0, data, length));
+}
+
 std::unique_ptr<Utf16CharacterStream> ScannerStream::ForTesting(
     const char* data, size_t length) {
   if (data == nullptr) {
@@ -802,9 +840,7 @@ std::unique_ptr<Utf16CharacterStream> ScannerStream::ForTesting(
     data = non_null_empty_string;
   }
 
-  return std::unique_ptr<Utf16CharacterStream>(
-      new BufferedCharacterStream<TestingStream>(
-          0, reinterpret_cast<const uint8_t*>(data), length));
+  return ForArray(reinterpret_cast<const uint8_t*>(data), length);
 }
 
 std::unique_ptr<Utf16CharacterStream> ScannerStream::ForTesting(
@@ -819,8 +855,7 @@ std::unique_ptr<Utf16CharacterStream> ScannerStream::ForTesting(
     data = non_null_empty_uint16_t_string;
   }
 
-  return std::unique_ptr<Utf16CharacterStream>(
-      new UnbufferedCharacterStream<TestingStream>(0, data, length));
+  return ForArray(data, length);
 }
 
 Utf16CharacterStream* ScannerStream::For(
@@ -28,6 +28,12 @@ class V8_EXPORT_PRIVATE ScannerStream {
       ScriptCompiler::ExternalSourceStream* source_stream,
       ScriptCompiler::StreamedSource::Encoding encoding);
 
+  // The array must outlive the stream and its clones.
+  static std::unique_ptr<Utf16CharacterStream> ForArray(const uint8_t* data,
+                                                        size_t length);
+  static std::unique_ptr<Utf16CharacterStream> ForArray(const uint16_t* data,
+                                                        size_t length);
+
   static std::unique_ptr<Utf16CharacterStream> ForTesting(const char* data);
   static std::unique_ptr<Utf16CharacterStream> ForTesting(const char* data,
                                                           size_t length);
@@ -7,6 +7,7 @@
 
 #include "src/parsing/keywords-gen.h"
 #include "src/parsing/scanner.h"
+#include "src/parsing/scanner-word-scan.h"
 #include "src/strings/char-predicates-inl.h"
 #include "src/utils/utils.h"
 
@@ -193,7 +194,6 @@ enum class ScanFlags : uint8_t {
   kCannotBeKeywordStart = 1 << 2,
   kStringTerminator = 1 << 3,
   kIdentifierNeedsSlowPath = 1 << 4,
-  kMultilineCommentCharacterNeedsSlowPath = 1 << 5,
 };
 constexpr uint8_t GetScanFlags(char c) {
   return
@@ -218,13 +218,7 @@ constexpr uint8_t GetScanFlags(char c) {
            : 0) |
       // Escapes are processed on the slow path.
       (c == '\\' ? static_cast<uint8_t>(ScanFlags::kIdentifierNeedsSlowPath)
-                 : 0) |
-      // Newlines and * are interesting characters for multiline comment
-      // scanning.
-      (c == '\n' || c == '\r' || c == '*'
-           ? static_cast<uint8_t>(
-                 ScanFlags::kMultilineCommentCharacterNeedsSlowPath)
-           : 0);
+                 : 0);
 }
 inline bool TerminatesLiteral(uint8_t scan_flags) {
   return (scan_flags & static_cast<uint8_t>(ScanFlags::kTerminatesLiteral));
@@ -236,10 +230,6 @@ inline bool IdentifierNeedsSlowPath(uint8_t scan_flags) {
   return (scan_flags &
           static_cast<uint8_t>(ScanFlags::kIdentifierNeedsSlowPath));
 }
-inline bool MultilineCommentCharacterNeedsSlowPath(uint8_t scan_flags) {
-  return (scan_flags & static_cast<uint8_t>(
-                           ScanFlags::kMultilineCommentCharacterNeedsSlowPath));
-}
 inline bool MayTerminateString(uint8_t scan_flags) {
   return (scan_flags & static_cast<uint8_t>(ScanFlags::kStringTerminator));
 }
@@ -273,30 +263,31 @@ V8_INLINE Token::Value Scanner::ScanIdentifierOrKeywordInner() {
       // Otherwise we'll fall into the slow path after scanning the identifier.
       DCHECK(!IdentifierNeedsSlowPath(scan_flags));
       AddLiteralChar(static_cast<char>(c0_));
-      AdvanceUntil([this, &scan_flags](uc32 c0) {
-        if (V8_UNLIKELY(static_cast<uint32_t>(c0) > kMaxAscii)) {
-          // A non-ascii character means we need to drop through to the slow
-          // path.
-          // TODO(leszeks): This would be most efficient as a goto to the slow
-          // path, check codegen and maybe use a bool instead.
-          scan_flags |=
-              static_cast<uint8_t>(ScanFlags::kIdentifierNeedsSlowPath);
-          return true;
-        }
-        uint8_t char_flags = character_scan_flags[c0];
-        scan_flags |= char_flags;
-        if (TerminatesLiteral(char_flags)) {
-          return true;
-        } else {
-          AddLiteralChar(static_cast<char>(c0));
-          return false;
-        }
+      // Find the end of the ASCII part of the identifier a word at a time.
+      AdvanceUntilInBlock([this](auto begin, auto end) {
+        auto stop = ScanWords::FindNonAsciiIdentifierPart(begin, end);
+        next().literal_chars.AddAsciiChars(begin,
+                                           static_cast<int>(stop - begin));
+        return stop;
       });
+      if (V8_UNLIKELY(c0_ == '\\' || (static_cast<uint32_t>(c0_) > kMaxAscii &&
+                                      c0_ != kEndOfInput))) {
+        // Escapes and non-ascii characters are handled on the slow path.
+        scan_flags |=
+            static_cast<uint8_t>(ScanFlags::kIdentifierNeedsSlowPath);
+      }
+      Vector<const uint8_t> chars = next().literal_chars.one_byte_literal();
+      if (chars.length() > MAX_WORD_LENGTH) {
+        scan_flags |= static_cast<uint8_t>(ScanFlags::kCannotBeKeyword);
+      } else {
+        for (int i = 1; i < chars.length(); i++) {
+          scan_flags |= character_scan_flags[chars[i]];
+        }
+      }
 
       if (V8_LIKELY(!IdentifierNeedsSlowPath(scan_flags))) {
         if (!CanBeKeyword(scan_flags)) return Token::IDENTIFIER;
         // Could be a keyword or identifier.
-        Vector<const uint8_t> chars = next().literal_chars.one_byte_literal();
         return KeywordOrIdentifierToken(chars.begin(), chars.length());
       }
 
@@ -325,10 +316,16 @@ V8_INLINE Token::Value Scanner::SkipWhiteSpace() {
 
   // Advance as long as character is a WhiteSpace or LineTerminator.
   while (IsWhiteSpaceOrLineTerminator(c0_)) {
-    if (!next().after_line_terminator && unibrow::IsLineTerminator(c0_)) {
-      next().after_line_terminator = true;
+    if (next().after_line_terminator) {
+      // Further line terminators don't matter, so skip the rest, typically
+      // indentation, a word at a time.
+      AdvanceUntilInBlock([](auto begin, auto end) {
+        return ScanWords::FindNonWhiteSpace(begin, end);
+      });
+    } else {
+      if (unibrow::IsLineTerminator(c0_)) next().after_line_terminator = true;
+      Advance();
     }
-    Advance();
   }
 
   // Return whether or not we skipped any characters.
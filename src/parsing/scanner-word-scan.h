@@ -0,0 +1,123 @@
+// Copyright 2021 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_PARSING_SCANNER_WORD_SCAN_H_
+#define V8_PARSING_SCANNER_WORD_SCAN_H_
+
+#include "src/common/globals.h"
+#include "src/strings/char-predicates-inl.h"
+#include "src/strings/unicode.h"
+#include "src/utils/word-units.h"
+
+namespace v8 {
+namespace internal {
+
+// Finds the end of identifiers, whitespace and comments a word of code units
+// at a time (see WordUnits), either in the scanner's UTF-16 buffer or
+// directly in a one-byte source. A word with any unit of interest, including
+// any non-ASCII unit, is looked at one unit at a time.
+class ScanWords final : public AllStatic {
+ public:
+  // Returns the first code unit in [begin, end) that isn't one of
+  // [a-zA-Z0-9_$], or end.
+  template <typename Char>
+  static const Char* FindNonAsciiIdentifierPart(const Char* begin,
+                                                const Char* end) {
+    using U = WordUnits<Char>;
+    return Find(
+        begin, end,
+        [](Word word) {
+          Word identifier_part =
+              U::InRange(word | U::kOnes * 0x20, 'a', 'z') |  // Letters.
+              U::InRange(word, '0', '9') | U::Equal(word, '_') |
+              U::Equal(word, '$');
+          return identifier_part ^ U::kHighBits;
+        },
+        [](uc32 c) { return !IsAsciiIdentifier(c); });
+  }
+
+  // Returns the first code unit in [begin, end) that isn't whitespace or a
+  // line terminator, or end.
+  template <typename Char>
+  static const Char* FindNonWhiteSpace(const Char* begin, const Char* end) {
+    using U = WordUnits<Char>;
+    return Find(
+        begin, end,
+        [](Word word) {
+          // \t, \n, \v, \f and \r are contiguous.
+          Word white_space =
+              U::Equal(word, ' ') | U::InRange(word, '\t', '\r');
+          return white_space ^ U::kHighBits;
+        },
+        [](uc32 c) { return !IsWhiteSpaceOrLineTerminator(c); });
+  }
+
+  // Returns the first line terminator in [begin, end), or end.
+  template <typename Char>
+  static const Char* FindLineTerminator(const Char* begin, const Char* end) {
+    using U = WordUnits<Char>;
+    return Find(
+        begin, end,
+        [](Word word) {
+          return U::NonAscii(word) | U::Equal(word, '\n') |
+                 U::Equal(word, '\r');
+        },
+        [](uc32 c) { return unibrow::IsLineTerminator(c); });
+  }
+
+  // Returns the first '*' or line terminator in [begin, end), or end.
+  template <typename Char>
+  static const Char* FindStarOrLineTerminator(const Char* begin,
+                                              const Char* end) {
+    using U = WordUnits<Char>;
+    return Find(
+        begin, end,
+        [](Word word) {
+          return U::NonAscii(word) | U::Equal(word, '*') |
+                 U::Equal(word, '\n') | U::Equal(word, '\r');
+        },
+        [](uc32 c) { return c == '*' || unibrow::IsLineTerminator(c); });
+  }
+
+  // Returns the first '*' in [begin, end), or end.
+  template <typename Char>
+  static const Char* FindStar(const Char* begin, const Char* end) {
+    using U = WordUnits<Char>;
+    return Find(
+        begin, end, [](Word word) { return U::Equal(word, '*'); },
+        [](uc32 c) { return c == '*'; });
+  }
+
+ private:
+  using Word = uintptr_t;
+
+  // Returns the first code unit in [begin, end) for which {matches} is true.
+  // {may_match} must return a non-zero value for every word that contains
+  // such a code unit.
+  template <typename Char, typename WordCheck, typename UnitCheck>
+  V8_INLINE static const Char* Find(const Char* begin, const Char* end,
+                                    WordCheck may_match, UnitCheck matches) {
+    using U = WordUnits<Char>;
+    const Char* cursor = begin;
+    while (end - cursor >= U::kPerWord) {
+      if (may_match(U::Load(cursor)) == 0) {
+        cursor += U::kPerWord;
+        continue;
+      }
+      for (const Char* word_end = cursor + U::kPerWord; cursor < word_end;
+           cursor++) {
+        if (matches(*cursor)) return cursor;
+      }
+    }
+    for (; cursor < end; cursor++) {
+      if (matches(*cursor)) return cursor;
+    }
+    return end;
+  }
+};
+
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_PARSING_SCANNER_WORD_SCAN_H_
@@ -209,7 +209,9 @@ Token::Value Scanner::SkipSingleLineComment() {
   // separately by the lexical grammar and becomes part of the
   // stream of input elements for the syntactic grammar (see
   // ECMA-262, section 7.4).
-  AdvanceUntil([](uc32 c0_) { return unibrow::IsLineTerminator(c0_); });
+  AdvanceUntilInBlock([](auto begin, auto end) {
+    return ScanWords::FindLineTerminator(begin, end);
+  });
 
   return Token::WHITESPACE;
 }
@@ -276,12 +278,8 @@ Token::Value Scanner::SkipMultiLineComment() {
   // Until we see the first newline, check for * and newline characters.
   if (!next().after_line_terminator) {
     do {
-      AdvanceUntil([](uc32 c0) {
-        if (V8_UNLIKELY(static_cast<uint32_t>(c0) > kMaxAscii)) {
-          return unibrow::IsLineTerminator(c0);
-        }
-        uint8_t char_flags = character_scan_flags[c0];
-        return MultilineCommentCharacterNeedsSlowPath(char_flags);
+      AdvanceUntilInBlock([](auto begin, auto end) {
+        return ScanWords::FindStarOrLineTerminator(begin, end);
       });
 
       while (c0_ == '*') {
@@ -301,7 +299,9 @@ Token::Value Scanner::SkipMultiLineComment() {
 
   // After we've seen newline, simply try to find '*/'.
   while (c0_ != kEndOfInput) {
-    AdvanceUntil([](uc32 c0) { return c0 == '*'; });
+    AdvanceUntilInBlock([](auto begin, auto end) {
+      return ScanWords::FindStar(begin, end);
+    });
 
     while (c0_ == '*') {
       Advance();
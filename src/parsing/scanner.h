@@ -73,15 +73,29 @@ class Utf16CharacterStream {
   // returns kEndOfInput.
   template <typename FunctionType>
   V8_INLINE uc32 AdvanceUntil(FunctionType check) {
+    return AdvanceUntilInBlock([&check](auto begin, auto end) {
+      return std::find_if(begin, end, [&check](auto raw_c0_) {
+        uc32 c0_ = static_cast<uc32>(raw_c0_);
+        return check(c0_);
+      });
+    });
+  }
+
+  // Like AdvanceUntil, but {find} is called with the buffered code units a
+  // block at a time, and returns the first one that meets its requirement or
+  // the end of the block. Runs that don't end in the current block are looked
+  // for directly in the one-byte source if there is one, so {find} must
+  // accept both uint16_t and uint8_t ranges.
+  template <typename FunctionType>
+  V8_INLINE uc32 AdvanceUntilInBlock(FunctionType find) {
     while (true) {
-      auto next_cursor_pos =
-          std::find_if(buffer_cursor_, buffer_end_, [&check](uint16_t raw_c0_) {
-            uc32 c0_ = static_cast<uc32>(raw_c0_);
-            return check(c0_);
-          });
+      const uint16_t* next_cursor_pos = find(buffer_cursor_, buffer_end_);
 
       if (next_cursor_pos == buffer_end_) {
         buffer_cursor_ = buffer_end_;
+        if (one_byte_start_ != nullptr && !has_parser_error()) {
+          return AdvanceUntilInOneByteSource(find);
+        }
         if (!ReadBlockChecked()) {
           buffer_cursor_++;
           return kEndOfInput;
@@ -165,6 +179,23 @@ class Utf16CharacterStream {
     return success;
   }
 
+  // Continues AdvanceUntilInBlock in the one-byte source, without widening
+  // the skipped code units into the buffer.
+  template <typename FunctionType>
+  uc32 AdvanceUntilInOneByteSource(FunctionType find) {
+    DCHECK_NOT_NULL(one_byte_start_);
+    DCHECK_LE(pos(), static_cast<size_t>(one_byte_end_ - one_byte_start_));
+    const uint8_t* next = find(one_byte_start_ + pos(), one_byte_end_);
+    if (next == one_byte_end_) {
+      Seek(one_byte_end_ - one_byte_start_);
+      DCHECK_EQ(buffer_cursor_, buffer_end_);
+      buffer_cursor_++;
+      return kEndOfInput;
+    }
+    Seek(next - one_byte_start_ + 1);
+    return static_cast<uc32>(*next);
+  }
+
   void ReadBlockAt(size_t new_pos) {
     // The callers of this method (Back/Back2/Seek) should handle the easy
     // case (seeking within the current buffer), and we should only get here
@@ -200,6 +231,10 @@ class Utf16CharacterStream {
   const uint16_t* buffer_cursor_;
   const uint16_t* buffer_end_;
   size_t buffer_pos_;
+  // The code units of the whole stream, if they are an off-heap one-byte
+  // array that stays in place.
+  const uint8_t* one_byte_start_ = nullptr;
+  const uint8_t* one_byte_end_ = nullptr;
   RuntimeCallStats* runtime_call_stats_;
   bool has_parser_error_ = false;
 };
@@ -529,6 +564,11 @@ class V8_EXPORT_PRIVATE Scanner {
     c0_ = source_->AdvanceUntil(check);
   }
 
+  template <typename FunctionType>
+  V8_INLINE void AdvanceUntilInBlock(FunctionType find) {
+    c0_ = source_->AdvanceUntilInBlock(find);
+  }
+
   bool CombineSurrogatePair() {
     DCHECK(!unibrow::Utf16::IsLeadSurrogate(kEndOfInput));
     if (unibrow::Utf16::IsLeadSurrogate(c0_)) {
@@ -0,0 +1,142 @@
+// Copyright 2021 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/regexp/regexp-bytecode-cache.h"
+
+#include <unordered_map>
+#include <vector>
+
+#include "src/base/functional.h"
+#include "src/base/lazy-instance.h"
+#include "src/base/platform/mutex.h"
+#include "src/execution/isolate.h"
+#include "src/flags/flags.h"
+#include "src/heap/factory.h"
+#include "src/objects/string-inl.h"
+
+namespace v8 {
+namespace internal {
+
+namespace {
+
+struct CacheKey {
+  std::vector<uc16> pattern;
+  int flags;
+  bool is_one_byte;
+  uint32_t backtrack_limit;
+  // Bytecode generation depends on a few flags, which embedders may set
+  // differently in between isolates.
+  uint32_t flag_hash;
+
+  bool operator==(const CacheKey& other) const {
+    return pattern == other.pattern && flags == other.flags &&
+           is_one_byte == other.is_one_byte &&
+           backtrack_limit == other.backtrack_limit &&
+           flag_hash == other.flag_hash;
+  }
+};
+
+struct CacheKeyHash {
+  size_t operator()(const CacheKey& key) const {
+    return base::hash_combine(
+        base::hash_range(key.pattern.begin(), key.pattern.end()), key.flags,
+        key.is_one_byte, key.backtrack_limit, key.flag_hash);
+  }
+};
+
+struct CacheValue {
+  std::vector<byte> bytecode;
+  int register_count;
+};
+
+CacheKey MakeKey(Handle<String> pattern, JSRegExp::Flags flags,
+                 bool is_one_byte, uint32_t backtrack_limit) {
+  DCHECK(pattern->IsFlat());
+  CacheKey key{{}, static_cast<int>(flags), is_one_byte, backtrack_limit,
+               FlagList::Hash()};
+  DisallowGarbageCollection no_gc;
+  String::FlatContent content = pattern->GetFlatContent(no_gc);
+  if (content.IsOneByte()) {
+    Vector<const uint8_t> chars = content.ToOneByteVector();
+    key.pattern.assign(chars.begin(), chars.end());
+  } else {
+    Vector<const uc16> chars = content.ToUC16Vector();
+    key.pattern.assign(chars.begin(), chars.end());
+  }
+  return key;
+}
+
+class BytecodeCache {
+ public:
+  bool Lookup(const CacheKey& key, CacheValue* value) {
+    base::MutexGuard guard(&mutex_);
+    auto it = map_.find(key);
+    if (it == map_.end()) return false;
+    *value = it->second;
+    hit_count_++;
+    return true;
+  }
+
+  void Insert(CacheKey key, CacheValue value) {
+    base::MutexGuard guard(&mutex_);
+    // Once full, the cache keeps the regexps compiled first, which for a pool
+    // of isolates running the same scripts are the ones the others need.
+    size_t size = key.pattern.size() * sizeof(uc16) + value.bytecode.size();
+    if (size_ + size > FLAG_regexp_shared_bytecode_cache_size * KB) return;
+    if (map_.emplace(std::move(key), std::move(value)).second) size_ += size;
+  }
+
+  size_t hit_count() {
+    base::MutexGuard guard(&mutex_);
+    return hit_count_;
+  }
+
+ private:
+  std::unordered_map<CacheKey, CacheValue, CacheKeyHash> map_;
+  size_t size_ = 0;
+  size_t hit_count_ = 0;
+  base::Mutex mutex_;
+};
+
+DEFINE_LAZY_LEAKY_OBJECT_GETTER(BytecodeCache, GetBytecodeCache)
+
+}  // namespace
+
+// static
+MaybeHandle<ByteArray> RegExpBytecodeCache::Lookup(
+    Isolate* isolate, Handle<String> pattern, JSRegExp::Flags flags,
+    bool is_one_byte, uint32_t backtrack_limit, int* register_count) {
+  if (FLAG_regexp_shared_bytecode_cache_size == 0) return {};
+  CacheValue value;
+  if (!GetBytecodeCache()->Lookup(
+          MakeKey(pattern, flags, is_one_byte, backtrack_limit), &value)) {
+    return {};
+  }
+  Handle<ByteArray> bytecode = isolate->factory()->NewByteArray(
+      static_cast<int>(value.bytecode.size()));
+  bytecode->copy_in(0, value.bytecode.data(),
+                    static_cast<int>(value.bytecode.size()));
+  *register_count = value.register_count;
+  return bytecode;
+}
+
+// static
+void RegExpBytecodeCache::Insert(Handle<String> pattern, JSRegExp::Flags flags,
+                                 bool is_one_byte, uint32_t backtrack_limit,
+                                 Handle<ByteArray> bytecode,
+                                 int register_count) {
+  if (FLAG_regexp_shared_bytecode_cache_size == 0) return;
+  CacheValue value{std::vector<byte>(bytecode->length()), register_count};
+  bytecode->copy_out(0, value.bytecode.data(), bytecode->length());
+  GetBytecodeCache()->Insert(
+      MakeKey(pattern, flags, is_one_byte, backtrack_limit), std::move(value));
+}
+
+// static
+size_t RegExpBytecodeCache::HitCountForTesting() {
+  return GetBytecodeCache()->hit_count();
+}
+
+}  // namespace internal
+}  // namespace v8
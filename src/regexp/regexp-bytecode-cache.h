@@ -0,0 +1,51 @@
+// Copyright 2021 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_REGEXP_REGEXP_BYTECODE_CACHE_H_
+#define V8_REGEXP_REGEXP_BYTECODE_CACHE_H_
+
+#include "src/common/globals.h"
+#include "src/handles/handles.h"
+#include "src/objects/js-regexp.h"
+
+namespace v8 {
+namespace internal {
+
+class ByteArray;
+class String;
+
+// A process-wide cache of irregexp bytecode (see
+// --regexp-shared-bytecode-cache-size). The bytecode of a regexp only depends
+// on its pattern, flags and backtrack limit, and contains no heap references,
+// so isolates compiling the same regexps (e.g. a pool of workers running the
+// same scripts) can reuse each other's bytecode instead of compiling it again.
+//
+// Native code is not shared, since it embeds isolate-specific references.
+//
+// The cache is off by default: it never evicts, serializes compilations of
+// all isolates on one mutex, and lets an isolate observe through compile
+// times which regexps other isolates have compiled. Embedders whose isolates
+// trust each other can opt in.
+class RegExpBytecodeCache final : public AllStatic {
+ public:
+  // Returns a copy of the cached bytecode for the given regexp, allocated in
+  // {isolate}'s heap, and sets {register_count} accordingly.
+  static MaybeHandle<ByteArray> Lookup(Isolate* isolate,
+                                       Handle<String> pattern,
+                                       JSRegExp::Flags flags, bool is_one_byte,
+                                       uint32_t backtrack_limit,
+                                       int* register_count);
+
+  // Adds {bytecode} to the cache, unless that would exceed the cache size.
+  static void Insert(Handle<String> pattern, JSRegExp::Flags flags,
+                     bool is_one_byte, uint32_t backtrack_limit,
+                     Handle<ByteArray> bytecode, int register_count);
+
+  static size_t HitCountForTesting();
+};
+
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_REGEXP_REGEXP_BYTECODE_CACHE_H_
@@ -0,0 +1,96 @@
+// Copyright 2021 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/regexp/regexp-code-budget.h"
+
+#include "src/execution/isolate.h"
+#include "src/handles/global-handles.h"
+#include "src/objects/js-regexp-inl.h"
+
+namespace v8 {
+namespace internal {
+
+void RegExpCodeBudget::AddNativeCode(Handle<FixedArray> data,
+                                     Handle<Code> code, bool is_one_byte) {
+  if (FLAG_regexp_native_code_budget == 0) return;
+  DCHECK_EQ(data->get(JSRegExp::code_index(is_one_byte)), *code);
+
+  int size = code->Size();
+  total_size_ += size;
+  // Evict before the new entry is queued, so that the code about to be run
+  // is never dropped.
+  EvictColdCode(FLAG_regexp_native_code_budget * KB);
+  data->set(JSRegExp::kIrregexpRecentlyUsedIndex, Smi::FromInt(1));
+
+  GlobalHandles* global_handles = isolate_->global_handles();
+  Address* data_location = global_handles->Create(*data).location();
+  Address* code_location = global_handles->Create(*code).location();
+  Entry entry{std::make_unique<Address*>(data_location),
+              std::make_unique<Address*>(code_location), is_one_byte, size};
+  GlobalHandles::MakeWeak(entry.data.get());
+  GlobalHandles::MakeWeak(entry.code.get());
+  entries_.push_back(std::move(entry));
+}
+
+void RegExpCodeBudget::EvictColdCode(size_t budget) {
+  DisallowGarbageCollection no_gc;
+  // Every entry is visited at most twice: once to clear its recently used bit,
+  // and once more to evict it.
+  size_t visits_left = 2 * entries_.size();
+  while (total_size_ > budget && visits_left-- > 0) {
+    Entry entry = std::move(entries_.front());
+    entries_.pop_front();
+    if (IsLive(entry)) {
+      FixedArray data = FixedArray::cast(Object(**entry.data));
+      if (data.get(JSRegExp::kIrregexpRecentlyUsedIndex) != Smi::zero()) {
+        data.set(JSRegExp::kIrregexpRecentlyUsedIndex, Smi::zero());
+        entries_.push_back(std::move(entry));
+        continue;
+      }
+      if (FLAG_trace_regexp_tier_up) {
+        PrintF("Dropping native code of regexp data %p (size: %d)\n",
+               reinterpret_cast<void*>(data.ptr()), entry.size);
+      }
+      Evict(entry);
+    }
+    total_size_ -= entry.size;
+    DestroyHandles(entry);
+  }
+}
+
+// static
+bool RegExpCodeBudget::IsLive(const Entry& entry) {
+  if (*entry.data == nullptr || *entry.code == nullptr) return false;
+  FixedArray data = FixedArray::cast(Object(**entry.data));
+  return data.get(JSRegExp::code_index(entry.is_one_byte)) ==
+         Object(**entry.code);
+}
+
+// static
+void RegExpCodeBudget::Evict(const Entry& entry) {
+  FixedArray data = FixedArray::cast(Object(**entry.data));
+  const Smi uninitialized = Smi::FromInt(JSRegExp::kUninitializedValue);
+  data.set(JSRegExp::code_index(entry.is_one_byte), uninitialized);
+  data.set(JSRegExp::bytecode_index(entry.is_one_byte), uninitialized);
+
+  // Start over in the interpreter, unless the other encoding still has native
+  // code: that code would then be mistaken for the interpreter trampoline.
+  const bool other = !entry.is_one_byte;
+  const bool other_is_native =
+      data.get(JSRegExp::code_index(other)).IsCode() &&
+      !data.get(JSRegExp::bytecode_index(other)).IsByteArray();
+  if (FLAG_regexp_tier_up && !other_is_native) {
+    data.set(JSRegExp::kIrregexpTicksUntilTierUpIndex,
+             Smi::FromInt(FLAG_regexp_tier_up_ticks));
+  }
+}
+
+// static
+void RegExpCodeBudget::DestroyHandles(const Entry& entry) {
+  if (*entry.data != nullptr) GlobalHandles::Destroy(*entry.data);
+  if (*entry.code != nullptr) GlobalHandles::Destroy(*entry.code);
+}
+
+}  // namespace internal
+}  // namespace v8
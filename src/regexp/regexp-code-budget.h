@@ -0,0 +1,69 @@
+// Copyright 2021 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_REGEXP_REGEXP_CODE_BUDGET_H_
+#define V8_REGEXP_REGEXP_CODE_BUDGET_H_
+
+#include <deque>
+#include <memory>
+
+#include "src/common/globals.h"
+#include "src/handles/handles.h"
+
+namespace v8 {
+namespace internal {
+
+class Code;
+class FixedArray;
+
+// Bounds the total size of native irregexp code held by an isolate (see
+// --regexp-native-code-budget). Once the budget is exceeded, the native code
+// of regexps that have not been executed recently is dropped, and these
+// regexps return to the bytecode interpreter until they tier up again.
+//
+// Recency is approximated with a second-chance scan: every native execution
+// sets JSRegExp::kIrregexpRecentlyUsedIndex, and the scan clears it before
+// giving an entry another round.
+class RegExpCodeBudget final {
+ public:
+  explicit RegExpCodeBudget(Isolate* isolate) : isolate_(isolate) {}
+  // Remaining weak handles are released together with the isolate's global
+  // handles.
+  ~RegExpCodeBudget() = default;
+  RegExpCodeBudget(const RegExpCodeBudget&) = delete;
+  RegExpCodeBudget& operator=(const RegExpCodeBudget&) = delete;
+
+  // Called after {code} has been installed as the native code for the given
+  // encoding in the regexp {data} array. May drop the code of other regexps.
+  void AddNativeCode(Handle<FixedArray> data, Handle<Code> code,
+                     bool is_one_byte);
+
+  size_t total_size() const { return total_size_; }
+
+ private:
+  struct Entry {
+    // Weak handles, reset to nullptr once the object dies. The locations are
+    // heap-allocated so that they stay put while entries move in the deque.
+    std::unique_ptr<Address*> data;
+    std::unique_ptr<Address*> code;
+    bool is_one_byte;
+    int size;
+  };
+
+  // Drops native code until the total size is within {budget} bytes.
+  void EvictColdCode(size_t budget);
+  // Returns whether {entry} still describes installed native code.
+  static bool IsLive(const Entry& entry);
+  static void Evict(const Entry& entry);
+  static void DestroyHandles(const Entry& entry);
+
+  Isolate* const isolate_;
+  std::deque<Entry> entries_;
+  size_t total_size_ = 0;
+};
+
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_REGEXP_REGEXP_CODE_BUDGET_H_
@@ -1541,6 +1541,7 @@ RegExpNode* RegExpQuantifier::ToNode(int min, int max, bool is_greedy,
                               : RegExpCompiler::kNoRegister;
   LoopChoiceNode* center = zone->New<LoopChoiceNode>(
       body->min_match() == 0, compiler->read_backward(), min, zone);
+  compiler->CountLoop();
   if (not_at_start && !compiler->read_backward()) center->set_not_at_start();
   RegExpNode* loop_return =
       needs_counter ? static_cast<RegExpNode*>(
@@ -251,6 +251,8 @@ RegExpCompiler::RegExpCompiler(Isolate* isolate, Zone* zone, int capture_count,
       limiting_recursion_(false),
       optimize_(FLAG_regexp_optimization),
       read_backward_(false),
+      loop_count_(0),
+      body_is_loop_free_(false),
       current_expansion_factor_(1),
       frequency_collator_(),
       isolate_(isolate),
@@ -3835,6 +3837,7 @@ RegExpNode* RegExpCompiler::PreprocessRegExp(RegExpCompileData* data,
   // Wrap the body of the regexp in capture #0.
   RegExpNode* captured_body =
       RegExpCapture::ToNode(data->tree, 0, this, accept());
+  body_is_loop_free_ = loop_count_ == 0;
   RegExpNode* node = captured_body;
   if (!data->tree->IsAnchoredAtStart() && !IsSticky(flags)) {
     // Add a .*? at the beginning, outside the body capture, unless
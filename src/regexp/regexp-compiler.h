@@ -563,6 +563,12 @@ class RegExpCompiler {
   }
   bool read_backward() { return read_backward_; }
   void set_read_backward(bool value) { read_backward_ = value; }
+  // Counts the loops created for quantifiers.
+  void CountLoop() { loop_count_++; }
+  // Whether the regexp body, i.e. everything but the implicit .*? in front of
+  // unanchored regexps, compiles to a node graph without loops. Every push to
+  // the backtrack stack then runs at most once per match attempt.
+  bool body_is_loop_free() const { return body_is_loop_free_; }
   FrequencyCollator* frequency_collator() { return &frequency_collator_; }
 
   int current_expansion_factor() { return current_expansion_factor_; }
@@ -588,6 +594,8 @@ class RegExpCompiler {
   bool limiting_recursion_;
   bool optimize_;
   bool read_backward_;
+  int loop_count_;
+  bool body_is_loop_free_;
   int current_expansion_factor_;
   FrequencyCollator frequency_collator_;
   Isolate* isolate_;
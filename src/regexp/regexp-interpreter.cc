@@ -383,7 +383,7 @@ IrregexpInterpreter::Result RawMatch(
     Vector<const Char> subject, int* output_registers,
     int output_register_count, int total_register_count, int current,
     uint32_t current_char, RegExp::CallOrigin call_origin,
-    const uint32_t backtrack_limit) {
+    const uint32_t backtrack_limit, uint32_t* backtrack_count_out) {
   DisallowGarbageCollection no_gc;
 
 #if V8_USE_COMPUTED_GOTO
@@ -402,13 +402,10 @@ IrregexpInterpreter::Result RawMatch(
 // Fill dispatch table from last defined bytecode up to the next power of two
 // with BREAK (invalid operation).
 // TODO(pthier): Find a way to fill up automatically (at compile time)
-// 59 real bytecodes -> 5 fillers
+// 62 real bytecodes -> 2 fillers
 #define BYTECODE_FILLER_ITERATOR(V) \
   V(BREAK) /* 1 */                  \
-  V(BREAK) /* 2 */                  \
-  V(BREAK) /* 3 */                  \
-  V(BREAK) /* 4 */                  \
-  V(BREAK) /* 5 */
+  V(BREAK) /* 2 */
 
 #define COUNT(...) +1
   static constexpr int kRegExpBytecodeFillerCount =
@@ -541,11 +538,17 @@ IrregexpInterpreter::Result RawMatch(
     BYTECODE(FAIL) {
       isolate->counters()->regexp_backtracks()->AddSample(
           static_cast<int>(backtrack_count));
+      if (backtrack_count_out != nullptr) {
+        *backtrack_count_out = backtrack_count;
+      }
       return IrregexpInterpreter::FAILURE;
     }
     BYTECODE(SUCCEED) {
       isolate->counters()->regexp_backtracks()->AddSample(
           static_cast<int>(backtrack_count));
+      if (backtrack_count_out != nullptr) {
+        *backtrack_count_out = backtrack_count;
+      }
       registers.CopyToOutputRegisters();
       return IrregexpInterpreter::SUCCESS;
     }
@@ -1023,6 +1026,53 @@ IrregexpInterpreter::Result RawMatch(
       SET_PC_FROM_OFFSET(Load32Aligned(pc + 16));
       DISPATCH();
     }
+    BYTECODE(SKIP_UNTIL_NOT_CHAR) {
+      int32_t load_offset = LoadPacked24Signed(insn);
+      int32_t advance = Load16AlignedSigned(pc + 4);
+      uint32_t c = Load16Aligned(pc + 6);
+      while (IndexIsInBounds(current + load_offset, subject.length())) {
+        current_char = subject[current + load_offset];
+        if (c != current_char) {
+          SET_PC_FROM_OFFSET(Load32Aligned(pc + 8));
+          DISPATCH();
+        }
+        ADVANCE_CURRENT_POSITION(advance);
+      }
+      SET_PC_FROM_OFFSET(Load32Aligned(pc + 12));
+      DISPATCH();
+    }
+    BYTECODE(SKIP_UNTIL_CHAR_IN_RANGE) {
+      int32_t load_offset = LoadPacked24Signed(insn);
+      int32_t advance = Load32Aligned(pc + 4);
+      uint32_t from = Load16Aligned(pc + 8);
+      uint32_t to = Load16Aligned(pc + 10);
+      while (IndexIsInBounds(current + load_offset, subject.length())) {
+        current_char = subject[current + load_offset];
+        if (from <= current_char && current_char <= to) {
+          SET_PC_FROM_OFFSET(Load32Aligned(pc + 12));
+          DISPATCH();
+        }
+        ADVANCE_CURRENT_POSITION(advance);
+      }
+      SET_PC_FROM_OFFSET(Load32Aligned(pc + 16));
+      DISPATCH();
+    }
+    BYTECODE(SKIP_UNTIL_CHAR_NOT_IN_RANGE) {
+      int32_t load_offset = LoadPacked24Signed(insn);
+      int32_t advance = Load32Aligned(pc + 4);
+      uint32_t from = Load16Aligned(pc + 8);
+      uint32_t to = Load16Aligned(pc + 10);
+      while (IndexIsInBounds(current + load_offset, subject.length())) {
+        current_char = subject[current + load_offset];
+        if (from > current_char || current_char > to) {
+          SET_PC_FROM_OFFSET(Load32Aligned(pc + 12));
+          DISPATCH();
+        }
+        ADVANCE_CURRENT_POSITION(advance);
+      }
+      SET_PC_FROM_OFFSET(Load32Aligned(pc + 16));
+      DISPATCH();
+    }
 #if V8_USE_COMPUTED_GOTO
 // Lint gets confused a lot if we just use !V8_USE_COMPUTED_GOTO or ifndef
 // V8_USE_COMPUTED_GOTO here.
@@ -1053,23 +1103,22 @@ IrregexpInterpreter::Result RawMatch(
 IrregexpInterpreter::Result IrregexpInterpreter::Match(
     Isolate* isolate, JSRegExp regexp, String subject_string,
     int* output_registers, int output_register_count, int start_position,
-    RegExp::CallOrigin call_origin) {
-  if (FLAG_regexp_tier_up) regexp.TierUpTick();
-
+    RegExp::CallOrigin call_origin, uint32_t* backtrack_count_out) {
   bool is_one_byte = String::IsOneByteRepresentationUnderneath(subject_string);
   ByteArray code_array = ByteArray::cast(regexp.Bytecode(is_one_byte));
   int total_register_count = regexp.MaxRegisterCount();
 
   return MatchInternal(isolate, code_array, subject_string, output_registers,
                        output_register_count, total_register_count,
-                       start_position, call_origin, regexp.BacktrackLimit());
+                       start_position, call_origin, regexp.BacktrackLimit(),
+                       backtrack_count_out);
 }
 
 IrregexpInterpreter::Result IrregexpInterpreter::MatchInternal(
     Isolate* isolate, ByteArray code_array, String subject_string,
     int* output_registers, int output_register_count, int total_register_count,
     int start_position, RegExp::CallOrigin call_origin,
-    uint32_t backtrack_limit) {
+    uint32_t backtrack_limit, uint32_t* backtrack_count_out) {
   DCHECK(subject_string.IsFlat());
 
   // Note: Heap allocation *is* allowed in two situations if calling from
@@ -1088,7 +1137,7 @@ IrregexpInterpreter::Result IrregexpInterpreter::MatchInternal(
     return RawMatch(isolate, code_array, subject_string, subject_vector,
                     output_registers, output_register_count,
                     total_register_count, start_position, previous_char,
-                    call_origin, backtrack_limit);
+                    call_origin, backtrack_limit, backtrack_count_out);
   } else {
     DCHECK(subject_content.IsTwoByte());
     Vector<const uc16> subject_vector = subject_content.ToUC16Vector();
@@ -1096,7 +1145,7 @@ IrregexpInterpreter::Result IrregexpInterpreter::MatchInternal(
     return RawMatch(isolate, code_array, subject_string, subject_vector,
                     output_registers, output_register_count,
                     total_register_count, start_position, previous_char,
-                    call_origin, backtrack_limit);
+                    call_origin, backtrack_limit, backtrack_count_out);
   }
 }
 
@@ -1126,8 +1175,15 @@ IrregexpInterpreter::Result IrregexpInterpreter::MatchForCallFromJs(
     return IrregexpInterpreter::RETRY;
   }
 
-  return Match(isolate, regexp_obj, subject_string, output_registers,
-               output_register_count, start_position, call_origin);
+  uint32_t backtrack_count = 0;
+  Result result = Match(isolate, regexp_obj, subject_string, output_registers,
+                        output_register_count, start_position, call_origin,
+                        &backtrack_count);
+  if (FLAG_regexp_tier_up && (result == SUCCESS || result == FAILURE)) {
+    regexp_obj.TierUpTick(subject_string.length() - start_position,
+                          backtrack_count);
+  }
+  return result;
 }
 
 #endif  // !COMPILING_IRREGEXP_FOR_EXTERNAL_EMBEDDER
@@ -1135,9 +1191,16 @@ IrregexpInterpreter::Result IrregexpInterpreter::MatchForCallFromJs(
 IrregexpInterpreter::Result IrregexpInterpreter::MatchForCallFromRuntime(
     Isolate* isolate, Handle<JSRegExp> regexp, Handle<String> subject_string,
     int* output_registers, int output_register_count, int start_position) {
-  return Match(isolate, *regexp, *subject_string, output_registers,
-               output_register_count, start_position,
-               RegExp::CallOrigin::kFromRuntime);
+  uint32_t backtrack_count = 0;
+  Result result = Match(isolate, *regexp, *subject_string, output_registers,
+                        output_register_count, start_position,
+                        RegExp::CallOrigin::kFromRuntime, &backtrack_count);
+  // Interrupts may have moved the regexp, so tick through the handle.
+  if (FLAG_regexp_tier_up && (result == SUCCESS || result == FAILURE)) {
+    regexp->TierUpTick(subject_string->length() - start_position,
+                       backtrack_count);
+  }
+  return result;
 }
 
 }  // namespace internal
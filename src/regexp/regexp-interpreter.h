@@ -49,17 +49,21 @@ class V8_EXPORT_PRIVATE IrregexpInterpreter : public AllStatic {
                                    RegExp::CallOrigin call_origin,
                                    Isolate* isolate, Address regexp);
 
+  // If {backtrack_count_out} is given, it receives the number of backtracks
+  // taken by a match that returns SUCCESS or FAILURE.
   static Result MatchInternal(Isolate* isolate, ByteArray code_array,
                               String subject_string, int* output_registers,
                               int output_register_count,
                               int total_register_count, int start_position,
                               RegExp::CallOrigin call_origin,
-                              uint32_t backtrack_limit);
+                              uint32_t backtrack_limit,
+                              uint32_t* backtrack_count_out = nullptr);
 
  private:
   static Result Match(Isolate* isolate, JSRegExp regexp, String subject_string,
                       int* output_registers, int output_register_count,
-                      int start_position, RegExp::CallOrigin call_origin);
+                      int start_position, RegExp::CallOrigin call_origin,
+                      uint32_t* backtrack_count_out);
 };
 
 }  // namespace internal
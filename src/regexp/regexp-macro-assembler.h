@@ -196,6 +196,14 @@ class RegExpMacroAssembler {
   // be controlled with set_backtrack_limit.
   void set_can_fallback(bool val) { can_fallback_ = val; }
 
+  // Set when every push to the backtrack stack runs at most once per match
+  // attempt (see RegExpCompiler::body_is_loop_free). Native back ends may then
+  // reserve backtrack stack space for all pushes once per match attempt,
+  // instead of checking the stack limit on pushes.
+  void set_backtrack_depth_bounded(bool val) {
+    backtrack_depth_bounded_ = val;
+  }
+
   enum GlobalMode {
     NOT_GLOBAL,
     GLOBAL_NO_ZERO_LENGTH_CHECK,
@@ -222,10 +230,13 @@ class RegExpMacroAssembler {
 
   bool can_fallback() const { return can_fallback_; }
 
+  bool backtrack_depth_bounded() const { return backtrack_depth_bounded_; }
+
  private:
   bool slow_safe_compiler_;
   uint32_t backtrack_limit_ = JSRegExp::kNoBacktrackLimit;
   bool can_fallback_ = false;
+  bool backtrack_depth_bounded_ = false;
   GlobalMode global_mode_;
   Isolate* isolate_;
   Zone* zone_;
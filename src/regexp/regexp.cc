@@ -9,8 +9,10 @@
 #include "src/heap/heap-inl.h"
 #include "src/objects/js-regexp-inl.h"
 #include "src/regexp/experimental/experimental.h"
+#include "src/regexp/regexp-bytecode-cache.h"
 #include "src/regexp/regexp-bytecode-generator.h"
 #include "src/regexp/regexp-bytecodes.h"
+#include "src/regexp/regexp-code-budget.h"
 #include "src/regexp/regexp-compiler.h"
 #include "src/regexp/regexp-dotprinter.h"
 #include "src/regexp/regexp-interpreter.h"
@@ -446,6 +448,106 @@ bool RegExpCodeIsValidForPreCompilation(Handle<JSRegExp> re, bool is_one_byte) {
 }  // namespace
 #endif
 
+namespace {
+
+// Upper bound on the length of the literal prefix used by the prefilter.
+constexpr int kMaxPrefilterLength = 64;
+
+// Appends the characters that every match of {tree} starts with to {prefix}.
+// Returns true if all of {tree} was consumed, i.e. if the prefix may be
+// extended by whatever follows {tree}.
+bool AppendLiteralPrefix(RegExpTree* tree, ZoneVector<uc16>* prefix) {
+  if (static_cast<int>(prefix->size()) >= kMaxPrefilterLength) return false;
+  if (tree->IsAtom()) {
+    RegExpAtom* atom = tree->AsAtom();
+    if (atom->ignore_case()) return false;
+    Vector<const uc16> data = atom->data();
+    prefix->insert(prefix->end(), data.begin(), data.end());
+    return true;
+  }
+  if (tree->IsText()) {
+    ZoneList<TextElement>* elements = tree->AsText()->elements();
+    for (int i = 0; i < elements->length(); i++) {
+      const TextElement& element = elements->at(i);
+      if (element.text_type() != TextElement::ATOM) return false;
+      if (!AppendLiteralPrefix(element.atom(), prefix)) return false;
+    }
+    return true;
+  }
+  if (tree->IsAlternative()) {
+    ZoneList<RegExpTree*>* nodes = tree->AsAlternative()->nodes();
+    for (int i = 0; i < nodes->length(); i++) {
+      if (!AppendLiteralPrefix(nodes->at(i), prefix)) return false;
+    }
+    return true;
+  }
+  if (tree->IsCapture()) {
+    return AppendLiteralPrefix(tree->AsCapture()->body(), prefix);
+  }
+  if (tree->IsGroup()) {
+    return AppendLiteralPrefix(tree->AsGroup()->body(), prefix);
+  }
+  if (tree->IsQuantifier()) {
+    // The body matches at least once, but what follows it is unknown.
+    RegExpQuantifier* quantifier = tree->AsQuantifier();
+    if (quantifier->min() > 0) {
+      AppendLiteralPrefix(quantifier->body(), prefix);
+    }
+    return false;
+  }
+  // Assertions and empty nodes don't consume any input.
+  if (tree->IsAssertion() || tree->IsEmpty()) return true;
+  // Disjunctions, character classes, lookarounds and back references.
+  return false;
+}
+
+// Returns the literal that every match of the regexp starts with, or an empty
+// handle if there is none worth searching for.
+MaybeHandle<String> ComputePrefilter(Isolate* isolate, Zone* zone,
+                                     RegExpTree* tree, JSRegExp::Flags flags) {
+  if (!FLAG_regexp_prefilter) return MaybeHandle<String>();
+  // Sticky regexps only match at the last index, and case-insensitive or
+  // unicode regexps may match subjects which don't contain the prefix
+  // verbatim.
+  if ((flags & (JSRegExp::kSticky | JSRegExp::kIgnoreCase |
+                JSRegExp::kUnicode)) != 0) {
+    return MaybeHandle<String>();
+  }
+  ZoneVector<uc16> prefix(zone);
+  AppendLiteralPrefix(tree, &prefix);
+  if (prefix.empty()) return MaybeHandle<String>();
+  if (static_cast<int>(prefix.size()) > kMaxPrefilterLength) {
+    prefix.resize(kMaxPrefilterLength);
+  }
+  return isolate->factory()->NewStringFromTwoByte(&prefix,
+                                                  AllocationType::kOld);
+}
+
+// Returns the first position at or after {index} at which {prefix} occurs in
+// {subject}, or -1.
+int FindPrefilterCandidate(Isolate* isolate, String prefix, String subject,
+                           int index) {
+  DisallowGarbageCollection no_gc;
+  String::FlatContent prefix_content = prefix.GetFlatContent(no_gc);
+  String::FlatContent subject_content = subject.GetFlatContent(no_gc);
+  DCHECK(prefix_content.IsFlat());
+  DCHECK(subject_content.IsFlat());
+  if (prefix_content.IsOneByte()) {
+    return subject_content.IsOneByte()
+               ? SearchString(isolate, subject_content.ToOneByteVector(),
+                              prefix_content.ToOneByteVector(), index)
+               : SearchString(isolate, subject_content.ToUC16Vector(),
+                              prefix_content.ToOneByteVector(), index);
+  }
+  return subject_content.IsOneByte()
+             ? SearchString(isolate, subject_content.ToOneByteVector(),
+                            prefix_content.ToUC16Vector(), index)
+             : SearchString(isolate, subject_content.ToUC16Vector(),
+                            prefix_content.ToUC16Vector(), index);
+}
+
+}  // namespace
+
 bool RegExpImpl::CompileIrregexp(Isolate* isolate, Handle<JSRegExp> re,
                                  Handle<String> sample_subject,
                                  bool is_one_byte) {
@@ -477,13 +579,29 @@ bool RegExpImpl::CompileIrregexp(Isolate* isolate, Handle<JSRegExp> re,
                                         ? RegExpCompilationTarget::kBytecode
                                         : RegExpCompilationTarget::kNative;
   uint32_t backtrack_limit = re->BacktrackLimit();
-  const bool compilation_succeeded =
-      Compile(isolate, &zone, &compile_data, flags, pattern, sample_subject,
-              is_one_byte, backtrack_limit);
-  if (!compilation_succeeded) {
-    DCHECK(compile_data.error != RegExpError::kNone);
-    RegExp::ThrowRegExpException(isolate, re, compile_data.error);
-    return false;
+  // Bytecode may have been compiled by another isolate already. The pattern is
+  // still parsed above, for the capture name map and the prefilter.
+  Handle<ByteArray> cached_bytecode;
+  if (compile_data.compilation_target == RegExpCompilationTarget::kBytecode &&
+      RegExpBytecodeCache::Lookup(isolate, pattern, flags, is_one_byte,
+                                  backtrack_limit, &compile_data.register_count)
+          .ToHandle(&cached_bytecode)) {
+    compile_data.code = cached_bytecode;
+    isolate->IncreaseTotalRegexpCodeGenerated(cached_bytecode);
+  } else {
+    const bool compilation_succeeded =
+        Compile(isolate, &zone, &compile_data, flags, pattern, sample_subject,
+                is_one_byte, backtrack_limit);
+    if (!compilation_succeeded) {
+      DCHECK(compile_data.error != RegExpError::kNone);
+      RegExp::ThrowRegExpException(isolate, re, compile_data.error);
+      return false;
+    }
+    if (compile_data.compilation_target == RegExpCompilationTarget::kBytecode) {
+      RegExpBytecodeCache::Insert(pattern, flags, is_one_byte, backtrack_limit,
+                                  Handle<ByteArray>::cast(compile_data.code),
+                                  compile_data.register_count);
+    }
   }
 
   Handle<FixedArray> data =
@@ -494,6 +612,8 @@ bool RegExpImpl::CompileIrregexp(Isolate* isolate, Handle<JSRegExp> re,
     // tier-up has happened this way.
     data->set(JSRegExp::bytecode_index(is_one_byte),
               Smi::FromInt(JSRegExp::kUninitializedValue));
+    isolate->regexp_code_budget()->AddNativeCode(
+        data, Handle<Code>::cast(compile_data.code), is_one_byte);
   } else {
     DCHECK_EQ(compile_data.compilation_target,
               RegExpCompilationTarget::kBytecode);
@@ -510,6 +630,12 @@ bool RegExpImpl::CompileIrregexp(Isolate* isolate, Handle<JSRegExp> re,
     SetIrregexpMaxRegisterCount(*data, compile_data.register_count);
   }
   data->set(JSRegExp::kIrregexpBacktrackLimit, Smi::FromInt(backtrack_limit));
+  Handle<String> prefilter;
+  if (data->get(JSRegExp::kIrregexpPrefilterIndex).IsSmi() &&
+      ComputePrefilter(isolate, &zone, compile_data.tree, flags)
+          .ToHandle(&prefilter)) {
+    data->set(JSRegExp::kIrregexpPrefilterIndex, *prefilter);
+  }
 
   if (FLAG_trace_regexp_tier_up) {
     PrintF("JSRegExp object %p %s size: %d\n",
@@ -578,11 +704,22 @@ int RegExpImpl::IrregexpExecRaw(Isolate* isolate, Handle<JSRegExp> regexp,
   DCHECK_GE(output_size,
             JSRegExp::RegistersForCaptureCount(regexp->CaptureCount()));
 
+  // Every match starts with the prefilter literal, so no match can start
+  // before its first occurrence.
+  Object prefilter = regexp->DataAt(JSRegExp::kIrregexpPrefilterIndex);
+  if (prefilter.IsString()) {
+    index = FindPrefilterCandidate(isolate, String::cast(prefilter), *subject,
+                                   index);
+    if (index == -1) return RegExp::RE_FAILURE;
+  }
+
   bool is_one_byte = String::IsOneByteRepresentationUnderneath(*subject);
 
   if (!regexp->ShouldProduceBytecode()) {
     do {
       EnsureCompiledIrregexp(isolate, regexp, subject, is_one_byte);
+      FixedArray::cast(regexp->data())
+          .set(JSRegExp::kIrregexpRecentlyUsedIndex, Smi::FromInt(1));
       // The stack is used to allocate registers for the compiled regexp code.
       // This means that in case of failure, the output registers array is left
       // untouched and contains the capture results from the previous successful
@@ -612,6 +749,12 @@ int RegExpImpl::IrregexpExecRaw(Isolate* isolate, Handle<JSRegExp> regexp,
   } else {
     DCHECK(regexp->ShouldProduceBytecode());
 
+    // The native code budget may have dropped the code of this regexp since it
+    // was prepared, sending it back to the interpreter without bytecode.
+    if (!regexp->Bytecode(is_one_byte).IsByteArray()) {
+      EnsureCompiledIrregexp(isolate, regexp, subject, is_one_byte);
+    }
+
     do {
       IrregexpInterpreter::Result result =
           IrregexpInterpreter::MatchForCallFromRuntime(
@@ -627,9 +770,7 @@ int RegExpImpl::IrregexpExecRaw(Isolate* isolate, Handle<JSRegExp> regexp,
           return result;
         case IrregexpInterpreter::RETRY:
           // The string has changed representation, and we must restart the
-          // match.
-          // We need to reset the tier up to start over with compilation.
-          if (FLAG_regexp_tier_up) regexp->ResetLastTierUpTick();
+          // match. Retried matches are not charged any tier-up ticks.
           is_one_byte = String::IsOneByteRepresentationUnderneath(*subject);
           EnsureCompiledIrregexp(isolate, regexp, subject, is_one_byte);
           break;
@@ -872,6 +1013,8 @@ bool RegExpImpl::Compile(Isolate* isolate, Zone* zone, RegExpCompileData* data,
     macro_assembler->set_backtrack_limit(backtrack_limit);
     macro_assembler->set_can_fallback(false);
   }
+  macro_assembler->set_backtrack_depth_bounded(
+      FLAG_regexp_elide_stack_checks && compiler.body_is_loop_free());
 
   // Inserted here, instead of in Assembler, because it depends on information
   // in the AST that isn't replicated in the Node structure.
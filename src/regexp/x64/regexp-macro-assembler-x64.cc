@@ -106,6 +106,7 @@ RegExpMacroAssemblerX64::RegExpMacroAssemblerX64(Isolate* isolate, Zone* zone,
       mode_(mode),
       num_registers_(registers_to_save),
       num_saved_registers_(registers_to_save),
+      backtrack_push_count_(0),
       entry_label_(),
       start_label_(),
       success_label_(),
@@ -823,6 +824,24 @@ Handle<HeapObject> RegExpMacroAssemblerX64::GetCode(Handle<String> source) {
   // Initialize backtrack stack pointer.
   __ movq(backtrack_stackpointer(), Operand(rbp, kStackHighEnd));
 
+  if (backtrack_depth_bounded()) {
+    // Pushes don't check the stack limit. Each of them runs at most once per
+    // match attempt, so grow the backtrack stack until all of them fit.
+    Label check_backtrack_stack, backtrack_stack_ok;
+    __ bind(&check_backtrack_stack);
+    __ load_rax(
+        ExternalReference::address_of_regexp_stack_limit_address(isolate()));
+    __ addq(rax, Immediate(backtrack_push_count_ * kIntSize));
+    __ cmpq(backtrack_stackpointer(), rax);
+    __ j(above, &backtrack_stack_ok);
+    // Growing the stack clobbers the current character.
+    __ pushq(current_character());
+    SafeCall(&stack_overflow_label_);
+    __ popq(current_character());
+    __ jmp(&check_backtrack_stack);
+    __ bind(&backtrack_stack_ok);
+  }
+
   __ jmp(&start_label_);
 
   // Exit code:
@@ -1072,21 +1091,24 @@ void RegExpMacroAssemblerX64::PopRegister(int register_index) {
 
 
 void RegExpMacroAssemblerX64::PushBacktrack(Label* label) {
+  backtrack_push_count_++;
   Push(label);
-  CheckStackLimit();
+  if (!backtrack_depth_bounded()) CheckStackLimit();
 }
 
 
 void RegExpMacroAssemblerX64::PushCurrentPosition() {
+  backtrack_push_count_++;
   Push(rdi);
 }
 
 
 void RegExpMacroAssemblerX64::PushRegister(int register_index,
                                            StackCheckFlag check_stack_limit) {
+  backtrack_push_count_++;
   __ movq(rax, register_location(register_index));
   Push(rax);
-  if (check_stack_limit) CheckStackLimit();
+  if (check_stack_limit && !backtrack_depth_bounded()) CheckStackLimit();
 }
 
 void RegExpMacroAssemblerX64::ReadCurrentPositionFromRegister(int reg) {
@@ -240,6 +240,9 @@ class V8_EXPORT_PRIVATE RegExpMacroAssemblerX64
   // are always 0..num_saved_registers_-1)
   int num_saved_registers_;
 
+  // Number of push instructions emitted for the backtrack stack.
+  int backtrack_push_count_;
+
   // Labels used internally.
   Label entry_label_;
   Label start_label_;
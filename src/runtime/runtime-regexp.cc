@@ -660,7 +660,7 @@ V8_WARN_UNUSED_RESULT static Object StringReplaceGlobalRegExpWithString(
     }
 
     if (simple_replace) {
-      builder.AddString(replacement);
+      if (replacement->length() > 0) builder.AddString(replacement);
     } else {
       compiled_replacement.Apply(&builder, start, end, current_match);
     }
@@ -1338,20 +1338,13 @@ V8_WARN_UNUSED_RESULT MaybeHandle<String> RegExpReplace(
     RETURN_ON_EXCEPTION(isolate, RegExpUtils::SetLastIndex(isolate, regexp, 0),
                         String);
 
-    // Force tier up to native code for global replaces. The global replace is
-    // implemented differently for native code and bytecode execution, where the
-    // native code expects an array to store all the matches, and the bytecode
-    // matches one at a time, so it's easier to tier-up to native code from the
-    // start.
-    if (FLAG_regexp_tier_up && regexp->TypeTag() == JSRegExp::IRREGEXP) {
-      regexp->MarkTierUpForNextExec();
-      if (FLAG_trace_regexp_tier_up) {
-        PrintF("Forcing tier-up of JSRegExp object %p in RegExpReplace\n",
-               reinterpret_cast<void*>(regexp->ptr()));
-      }
-    }
-
-    if (replace->length() == 0) {
+    // The global replace fetches one match per execution of the bytecode, and
+    // tiers up to native code once the regexp has been executed often enough.
+    // Removing matches writes directly into the result string and must not
+    // trigger a recompilation, so it requires native code from the start.
+    const bool produces_bytecode = regexp->TypeTag() == JSRegExp::IRREGEXP &&
+                                   regexp->ShouldProduceBytecode();
+    if (replace->length() == 0 && !produces_bytecode) {
       if (string->IsOneByteRepresentation()) {
         Object result =
             StringReplaceGlobalRegExpWithEmptyString<SeqOneByteString>(
@@ -1792,122 +1785,134 @@ RUNTIME_FUNCTION(Runtime_RegExpReplaceRT) {
     }
   }
 
-  // TODO(jgruber): Look into ReplacementStringBuilder instead.
-  IncrementalStringBuilder builder(isolate);
+  // Unreplaced parts of the subject are added as slices, which are only
+  // copied out when the result is assembled.
+  static const int kInitialPartCount = 16;
+  ReplacementStringBuilder builder(isolate->heap(), string,
+                                   kInitialPartCount);
   uint32_t next_source_position = 0;
 
   for (const auto& result : results) {
-    HandleScope handle_scope(isolate);
-    Handle<Object> captures_length_obj;
-    ASSIGN_RETURN_FAILURE_ON_EXCEPTION(
-        isolate, captures_length_obj,
-        Object::GetProperty(isolate, result, factory->length_string()));
-
-    ASSIGN_RETURN_FAILURE_ON_EXCEPTION(
-        isolate, captures_length_obj,
-        Object::ToLength(isolate, captures_length_obj));
-    const uint32_t captures_length =
-        PositiveNumberToUint32(*captures_length_obj);
-
-    Handle<Object> match_obj;
-    ASSIGN_RETURN_FAILURE_ON_EXCEPTION(isolate, match_obj,
-                                       Object::GetElement(isolate, result, 0));
-
-    Handle<String> match;
-    ASSIGN_RETURN_FAILURE_ON_EXCEPTION(isolate, match,
-                                       Object::ToString(isolate, match_obj));
+    Handle<String> replacement;
+    uint32_t position;
+    int match_length;
+    {
+      // The builder creates handles when it grows, which have to outlive the
+      // per-match handles of this scope, so it is only used after the scope.
+      HandleScope handle_scope(isolate);
+      Handle<Object> captures_length_obj;
+      ASSIGN_RETURN_FAILURE_ON_EXCEPTION(
+          isolate, captures_length_obj,
+          Object::GetProperty(isolate, result, factory->length_string()));
 
-    const int match_length = match->length();
+      ASSIGN_RETURN_FAILURE_ON_EXCEPTION(
+          isolate, captures_length_obj,
+          Object::ToLength(isolate, captures_length_obj));
+      const uint32_t captures_length =
+          PositiveNumberToUint32(*captures_length_obj);
 
-    Handle<Object> position_obj;
-    ASSIGN_RETURN_FAILURE_ON_EXCEPTION(
-        isolate, position_obj,
-        Object::GetProperty(isolate, result, factory->index_string()));
+      Handle<Object> match_obj;
+      ASSIGN_RETURN_FAILURE_ON_EXCEPTION(
+          isolate, match_obj, Object::GetElement(isolate, result, 0));
 
-    ASSIGN_RETURN_FAILURE_ON_EXCEPTION(
-        isolate, position_obj, Object::ToInteger(isolate, position_obj));
-    const uint32_t position =
-        std::min(PositiveNumberToUint32(*position_obj), length);
+      Handle<String> match;
+      ASSIGN_RETURN_FAILURE_ON_EXCEPTION(isolate, match,
+                                         Object::ToString(isolate, match_obj));
 
-    // Do not reserve capacity since captures_length is user-controlled.
-    ZoneVector<Handle<Object>> captures(&zone);
+      match_length = match->length();
 
-    for (uint32_t n = 0; n < captures_length; n++) {
-      Handle<Object> capture;
+      Handle<Object> position_obj;
       ASSIGN_RETURN_FAILURE_ON_EXCEPTION(
-          isolate, capture, Object::GetElement(isolate, result, n));
+          isolate, position_obj,
+          Object::GetProperty(isolate, result, factory->index_string()));
 
-      if (!capture->IsUndefined(isolate)) {
-        ASSIGN_RETURN_FAILURE_ON_EXCEPTION(isolate, capture,
-                                           Object::ToString(isolate, capture));
-      }
-      captures.push_back(capture);
-    }
+      ASSIGN_RETURN_FAILURE_ON_EXCEPTION(
+          isolate, position_obj, Object::ToInteger(isolate, position_obj));
+      position = std::min(PositiveNumberToUint32(*position_obj), length);
 
-    Handle<Object> groups_obj = isolate->factory()->undefined_value();
-    ASSIGN_RETURN_FAILURE_ON_EXCEPTION(
-        isolate, groups_obj,
-        Object::GetProperty(isolate, result, factory->groups_string()));
+      // Do not reserve capacity since captures_length is user-controlled.
+      ZoneVector<Handle<Object>> captures(&zone);
 
-    const bool has_named_captures = !groups_obj->IsUndefined(isolate);
+      for (uint32_t n = 0; n < captures_length; n++) {
+        Handle<Object> capture;
+        ASSIGN_RETURN_FAILURE_ON_EXCEPTION(
+            isolate, capture, Object::GetElement(isolate, result, n));
 
-    Handle<String> replacement;
-    if (functional_replace) {
-      const uint32_t argc =
-          GetArgcForReplaceCallable(captures_length, has_named_captures);
-      if (argc == static_cast<uint32_t>(-1)) {
-        THROW_NEW_ERROR_RETURN_FAILURE(
-            isolate, NewRangeError(MessageTemplate::kTooManyArguments));
+        if (!capture->IsUndefined(isolate)) {
+          ASSIGN_RETURN_FAILURE_ON_EXCEPTION(
+              isolate, capture, Object::ToString(isolate, capture));
+        }
+        captures.push_back(capture);
       }
 
-      ScopedVector<Handle<Object>> argv(argc);
+      Handle<Object> groups_obj = isolate->factory()->undefined_value();
+      ASSIGN_RETURN_FAILURE_ON_EXCEPTION(
+          isolate, groups_obj,
+          Object::GetProperty(isolate, result, factory->groups_string()));
+
+      const bool has_named_captures = !groups_obj->IsUndefined(isolate);
+
+      Handle<String> replacement_in_scope;
+      if (functional_replace) {
+        const uint32_t argc =
+            GetArgcForReplaceCallable(captures_length, has_named_captures);
+        if (argc == static_cast<uint32_t>(-1)) {
+          THROW_NEW_ERROR_RETURN_FAILURE(
+              isolate, NewRangeError(MessageTemplate::kTooManyArguments));
+        }
 
-      int cursor = 0;
-      for (uint32_t j = 0; j < captures_length; j++) {
-        argv[cursor++] = captures[j];
-      }
+        ScopedVector<Handle<Object>> argv(argc);
 
-      argv[cursor++] = handle(Smi::FromInt(position), isolate);
-      argv[cursor++] = string;
-      if (has_named_captures) argv[cursor++] = groups_obj;
+        int cursor = 0;
+        for (uint32_t j = 0; j < captures_length; j++) {
+          argv[cursor++] = captures[j];
+        }
 
-      DCHECK_EQ(cursor, argc);
+        argv[cursor++] = handle(Smi::FromInt(position), isolate);
+        argv[cursor++] = string;
+        if (has_named_captures) argv[cursor++] = groups_obj;
 
-      Handle<Object> replacement_obj;
-      ASSIGN_RETURN_FAILURE_ON_EXCEPTION(
-          isolate, replacement_obj,
-          Execution::Call(isolate, replace_obj, factory->undefined_value(),
-                          argc, argv.begin()));
+        DCHECK_EQ(cursor, argc);
 
-      ASSIGN_RETURN_FAILURE_ON_EXCEPTION(
-          isolate, replacement, Object::ToString(isolate, replacement_obj));
-    } else {
-      DCHECK(!functional_replace);
-      if (!groups_obj->IsUndefined(isolate)) {
+        Handle<Object> replacement_obj;
+        ASSIGN_RETURN_FAILURE_ON_EXCEPTION(
+            isolate, replacement_obj,
+            Execution::Call(isolate, replace_obj, factory->undefined_value(),
+                            argc, argv.begin()));
+
+        ASSIGN_RETURN_FAILURE_ON_EXCEPTION(
+            isolate, replacement_in_scope,
+            Object::ToString(isolate, replacement_obj));
+      } else {
+        DCHECK(!functional_replace);
+        if (!groups_obj->IsUndefined(isolate)) {
+          ASSIGN_RETURN_FAILURE_ON_EXCEPTION(
+              isolate, groups_obj, Object::ToObject(isolate, groups_obj));
+        }
+        VectorBackedMatch m(isolate, string, match, position, &captures,
+                            groups_obj);
         ASSIGN_RETURN_FAILURE_ON_EXCEPTION(
-            isolate, groups_obj, Object::ToObject(isolate, groups_obj));
+            isolate, replacement_in_scope,
+            String::GetSubstitution(isolate, &m, replace));
       }
-      VectorBackedMatch m(isolate, string, match, position, &captures,
-                          groups_obj);
-      ASSIGN_RETURN_FAILURE_ON_EXCEPTION(
-          isolate, replacement, String::GetSubstitution(isolate, &m, replace));
+      replacement = handle_scope.CloseAndEscape(replacement_in_scope);
     }
 
     if (position >= next_source_position) {
-      builder.AppendString(
-          factory->NewSubString(string, next_source_position, position));
-      builder.AppendString(replacement);
+      if (position > next_source_position) {
+        builder.AddSubjectSlice(next_source_position, position);
+      }
+      if (replacement->length() > 0) builder.AddString(replacement);
 
       next_source_position = position + match_length;
     }
   }
 
   if (next_source_position < length) {
-    builder.AppendString(
-        factory->NewSubString(string, next_source_position, length));
+    builder.AddSubjectSlice(next_source_position, length);
   }
 
-  RETURN_RESULT_OR_FAILURE(isolate, builder.Finish());
+  RETURN_RESULT_OR_FAILURE(isolate, builder.ToString());
 }
 
 RUNTIME_FUNCTION(Runtime_RegExpInitializeAndCompile) {
@@ -4,7 +4,10 @@
 
 #include "src/snapshot/code-serializer.h"
 
+#include <vector>
+
 #include "src/base/platform/platform.h"
+#include "src/codegen/compiler.h"
 #include "src/codegen/macro-assembler.h"
 #include "src/common/globals.h"
 #include "src/debug/debug.h"
@@ -38,6 +41,35 @@ CodeSerializer::CodeSerializer(Isolate* isolate, uint32_t source_hash)
     : Serializer(isolate, Snapshot::kDefaultSerializerFlags),
       source_hash_(source_hash) {}
 
+namespace {
+
+// Compiles the functions of {script} whose bytecode has been flushed. These
+// functions were needed before, so they are serialized with bytecode instead
+// of being reparsed when they are called again after the cache is consumed.
+void RecompileFlushedFunctions(Isolate* isolate, Handle<Script> script) {
+  HandleScope scope(isolate);
+  std::vector<Handle<SharedFunctionInfo>> flushed;
+  {
+    SharedFunctionInfo::ScriptIterator iterator(isolate, *script);
+    for (SharedFunctionInfo info = iterator.Next(); !info.is_null();
+         info = iterator.Next()) {
+      if (info.has_flushed_bytecode() && !info.is_compiled()) {
+        flushed.push_back(handle(info, isolate));
+      }
+    }
+  }
+  for (Handle<SharedFunctionInfo> info : flushed) {
+    if (info->is_compiled()) continue;
+    IsCompiledScope is_compiled_scope;
+    Compiler::Compile(info, Compiler::CLEAR_EXCEPTION, &is_compiled_scope);
+  }
+  if (FLAG_trace_serializer) {
+    PrintF("[Recompiled %zu flushed functions]\n", flushed.size());
+  }
+}
+
+}  // namespace
+
 // static
 ScriptCompiler::CachedData* CodeSerializer::Serialize(
     Handle<SharedFunctionInfo> info) {
@@ -60,6 +92,10 @@ ScriptCompiler::CachedData* CodeSerializer::Serialize(
   // context independent.
   if (script->ContainsAsmModule()) return nullptr;
 
+  if (FLAG_code_cache_recompile_flushed) {
+    RecompileFlushedFunctions(isolate, script);
+  }
+
   // Serialize code object.
   Handle<String> source(String::cast(script->source()), isolate);
   HandleScope scope(isolate);
@@ -12,6 +12,7 @@
 #include "src/objects/fixed-array.h"
 #include "src/objects/objects.h"
 #include "src/objects/string-inl.h"
+#include "src/utils/memcopy.h"
 #include "src/utils/utils.h"
 
 namespace v8 {
@@ -117,6 +118,22 @@ class IncrementalStringBuilder {
  public:
   explicit IncrementalStringBuilder(Isolate* isolate);
 
+  // Receives the contents of a streaming builder (see StreamTo) part by part.
+  // Must not allocate on the V8 heap.
+  class Sink {
+   public:
+    virtual ~Sink() = default;
+    // Returns false to stop accepting output.
+    virtual bool Write(Vector<const uint8_t> chars) = 0;
+    virtual bool Write(Vector<const uc16> chars) = 0;
+  };
+
+  // Makes the builder pass its contents to {sink} whenever a part is full,
+  // instead of accumulating them into a string. Must be called before
+  // anything is appended. Once the sink stops accepting output, the builder
+  // reports an overflow and drops what is appended.
+  void StreamTo(Sink* sink);
+
   V8_INLINE String::Encoding CurrentEncoding() { return encoding_; }
 
   template <typename SrcChar, typename DestChar>
@@ -147,6 +164,27 @@ class IncrementalStringBuilder {
     }
   }
 
+  // Appends {chars} with a single copy if they fit into the current part.
+  V8_INLINE void AppendCharacters(Vector<const uint8_t> chars) {
+    if (!CurrentPartCanFit(chars.length())) {
+      for (uint8_t c : chars) AppendCharacter(c);
+      return;
+    }
+    DisallowGarbageCollection no_gc;
+    if (encoding_ == String::ONE_BYTE_ENCODING) {
+      CopyChars(SeqOneByteString::cast(*current_part_).GetChars(no_gc) +
+                    current_index_,
+                chars.begin(), chars.length());
+    } else {
+      CopyChars(SeqTwoByteString::cast(*current_part_).GetChars(no_gc) +
+                    current_index_,
+                chars.begin(), chars.length());
+    }
+    // CurrentPartCanFit leaves room for at least one more character, so the
+    // part does not need to be extended yet.
+    current_index_ += chars.length();
+  }
+
   V8_INLINE void AppendInt(int i) {
     char buffer[kIntToCStringBufferSize];
     const char* str =
@@ -175,6 +213,10 @@ class IncrementalStringBuilder {
 
   MaybeHandle<String> Finish();
 
+  // Passes the rest of the contents of a streaming builder to its sink.
+  // Returns false if the sink stopped accepting output.
+  bool FinishStreaming();
+
   V8_INLINE bool HasOverflowed() const { return overflowed_; }
 
   int Length() const;
@@ -182,6 +224,13 @@ class IncrementalStringBuilder {
   // Change encoding to two-byte.
   void ChangeEncoding() {
     DCHECK_EQ(String::ONE_BYTE_ENCODING, encoding_);
+    if (sink_ != nullptr) {
+      FlushToSink();
+      encoding_ = String::TWO_BYTE_ENCODING;
+      set_current_part(
+          factory()->NewRawTwoByteString(part_length_).ToHandleChecked());
+      return;
+    }
     ShrinkCurrentPart();
     encoding_ = String::TWO_BYTE_ENCODING;
     Extend();
@@ -277,6 +326,9 @@ class IncrementalStringBuilder {
   // Finish the current part and allocate a new part.
   void Extend();
 
+  // Pass the current part to the sink, and start over with it.
+  void FlushToSink();
+
   // Shrink current part to the right size.
   void ShrinkCurrentPart() {
     DCHECK(current_index_ < part_length_);
@@ -299,6 +351,7 @@ class IncrementalStringBuilder {
   int current_index_;
   Handle<String> accumulator_;
   Handle<String> current_part_;
+  Sink* sink_ = nullptr;
 };
 
 template <typename SrcChar, typename DestChar>
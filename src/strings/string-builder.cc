@@ -260,6 +260,10 @@ void IncrementalStringBuilder::Accumulate(Handle<String> new_part) {
 
 void IncrementalStringBuilder::Extend() {
   DCHECK_EQ(current_index_, current_part()->length());
+  if (sink_ != nullptr) {
+    FlushToSink();
+    return;
+  }
   Accumulate(current_part());
   if (part_length_ <= kMaxPartLength / kPartLengthGrowthFactor) {
     part_length_ *= kPartLengthGrowthFactor;
@@ -275,7 +279,42 @@ void IncrementalStringBuilder::Extend() {
   current_index_ = 0;
 }
 
+void IncrementalStringBuilder::StreamTo(Sink* sink) {
+  DCHECK_EQ(0, Length());
+  DCHECK_EQ(String::ONE_BYTE_ENCODING, encoding_);
+  sink_ = sink;
+  // Parts are reused, so they may as well be large.
+  part_length_ = kMaxPartLength;
+  set_current_part(
+      factory()->NewRawOneByteString(part_length_).ToHandleChecked());
+}
+
+void IncrementalStringBuilder::FlushToSink() {
+  DCHECK_NOT_NULL(sink_);
+  if (!overflowed_ && current_index_ > 0) {
+    DisallowGarbageCollection no_gc;
+    bool accepted;
+    if (encoding_ == String::ONE_BYTE_ENCODING) {
+      accepted = sink_->Write(Vector<const uint8_t>(
+          SeqOneByteString::cast(*current_part()).GetChars(no_gc),
+          current_index_));
+    } else {
+      accepted = sink_->Write(Vector<const uc16>(
+          SeqTwoByteString::cast(*current_part()).GetChars(no_gc),
+          current_index_));
+    }
+    if (!accepted) overflowed_ = true;
+  }
+  current_index_ = 0;
+}
+
+bool IncrementalStringBuilder::FinishStreaming() {
+  FlushToSink();
+  return !overflowed_;
+}
+
 MaybeHandle<String> IncrementalStringBuilder::Finish() {
+  DCHECK_NULL(sink_);
   ShrinkCurrentPart();
   Accumulate(current_part());
   if (overflowed_) {
@@ -319,6 +358,19 @@ void IncrementalStringBuilder::AppendString(Handle<String> string) {
     return;
   }
 
+  if (sink_ != nullptr) {
+    FlushToSink();
+    if (overflowed_) return;
+    string = String::Flatten(isolate_, string);
+    DisallowGarbageCollection no_gc;
+    String::FlatContent content = string->GetFlatContent(no_gc);
+    bool accepted = content.IsOneByte()
+                        ? sink_->Write(content.ToOneByteVector())
+                        : sink_->Write(content.ToUC16Vector());
+    if (!accepted) overflowed_ = true;
+    return;
+  }
+
   ShrinkCurrentPart();
   part_length_ = kInitialPartLength;  // Allocate conservatively.
   Extend();  // Attach current part and allocate new part.
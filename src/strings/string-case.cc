@@ -5,6 +5,7 @@
 #include "src/strings/string-case.h"
 
 #include "src/base/logging.h"
+#include "src/base/memory.h"
 #include "src/common/assert-scope.h"
 #include "src/common/globals.h"
 #include "src/utils/utils.h"
@@ -12,10 +13,19 @@
 namespace v8 {
 namespace internal {
 
-// FastAsciiConvert tries to do character processing on a word_t basis if
-// source and destination strings are properly aligned. Natural alignment of
-// string data depends on kTaggedSize so we define word_t via Tagged_t.
-using word_t = std::make_unsigned<Tagged_t>::type;
+// FastAsciiConvert does character processing on a word_t basis. String data
+// is only kTaggedSize aligned, and sliced strings start at arbitrary offsets,
+// so words are loaded and stored with base::{Read,Write}UnalignedValue. Hosts
+// where unaligned accesses are slow only take the word path if both source
+// and destination happen to be aligned.
+using word_t = uintptr_t;
+
+#if V8_HOST_ARCH_X64 || V8_HOST_ARCH_IA32 || V8_HOST_ARCH_ARM64 || \
+    V8_HOST_ARCH_ARM
+constexpr bool kUnalignedAccessIsCheap = true;
+#else
+constexpr bool kUnalignedAccessIsCheap = false;
+#endif
 
 const word_t kWordTAllBitsSet = std::numeric_limits<word_t>::max();
 const word_t kOneInEveryByte = kWordTAllBitsSet / 0xFF;
@@ -75,39 +85,40 @@ int FastAsciiConvert(char* dst, const char* src, int length,
   bool changed = false;
   const char* const limit = src + length;
 
-  // dst is newly allocated and always aligned.
-  DCHECK(IsAligned(reinterpret_cast<Address>(dst), sizeof(word_t)));
-  // Only attempt processing one word at a time if src is also aligned.
-  if (IsAligned(reinterpret_cast<Address>(src), sizeof(word_t))) {
-    // Process the prefix of the input that requires no conversion one aligned
+  if (kUnalignedAccessIsCheap ||
+      (IsAligned(reinterpret_cast<Address>(src), sizeof(word_t)) &&
+       IsAligned(reinterpret_cast<Address>(dst), sizeof(word_t)))) {
+    // Process the prefix of the input that requires no conversion one
     // (machine) word at a time.
     while (src <= limit - sizeof(word_t)) {
-      const word_t w = *reinterpret_cast<const word_t*>(src);
+      const word_t w =
+          base::ReadUnalignedValue<word_t>(reinterpret_cast<Address>(src));
       if ((w & kAsciiMask) != 0) return static_cast<int>(src - saved_src);
       if (AsciiRangeMask(w, lo, hi) != 0) {
         changed = true;
         break;
       }
-      *reinterpret_cast<word_t*>(dst) = w;
+      base::WriteUnalignedValue(reinterpret_cast<Address>(dst), w);
       src += sizeof(word_t);
       dst += sizeof(word_t);
     }
     // Process the remainder of the input performing conversion when
     // required one word at a time.
     while (src <= limit - sizeof(word_t)) {
-      const word_t w = *reinterpret_cast<const word_t*>(src);
+      const word_t w =
+          base::ReadUnalignedValue<word_t>(reinterpret_cast<Address>(src));
       if ((w & kAsciiMask) != 0) return static_cast<int>(src - saved_src);
       word_t m = AsciiRangeMask(w, lo, hi);
       // The mask has high (7th) bit set in every byte that needs
       // conversion and we know that the distance between cases is
       // 1 << 5.
-      *reinterpret_cast<word_t*>(dst) = w ^ (m >> 2);
+      base::WriteUnalignedValue(reinterpret_cast<Address>(dst), w ^ (m >> 2));
       src += sizeof(word_t);
       dst += sizeof(word_t);
     }
   }
   // Process the last few bytes of the input (or the whole input if
-  // unaligned access is not supported).
+  // unaligned access is slow and the input is not aligned).
   while (src < limit) {
     char c = *src;
     if ((c & kAsciiMask) != 0) return static_cast<int>(src - saved_src);
@@ -7,6 +7,7 @@
 
 #include "src/execution/isolate.h"
 #include "src/utils/vector.h"
+#include "src/utils/word-units.h"
 
 namespace v8 {
 namespace internal {
@@ -40,6 +41,12 @@ class StringSearchBase {
   // to compensate for the algorithmic overhead compared to simple brute force.
   static const int kBMMinPatternLength = 7;
 
+  // After this many positions where the first character of the pattern
+  // occurs but the pattern does not match, the first character is considered
+  // too common to look for on its own, and candidates are filtered on both the
+  // first and the last character of the pattern instead.
+  static const int kMaxFirstCharacterMisses = 4;
+
   static inline bool IsOneByteString(Vector<const uint8_t> string) {
     return true;
   }
@@ -222,6 +229,42 @@ inline int FindFirstCharacter(Vector<const PatternChar> pattern,
   return -1;
 }
 
+// Returns the first position at or after {index} where the subject contains
+// both the first and the last character of {pattern} at the right distance,
+// or -1. On 64-bit little-endian hosts, a word of subject characters is
+// compared at a time.
+template <typename PatternChar, typename SubjectChar>
+inline int FindFirstAndLastCharacter(Vector<const PatternChar> pattern,
+                                     Vector<const SubjectChar> subject,
+                                     int index) {
+  DCHECK_GT(pattern.length(), 1);
+  const int last_offset = pattern.length() - 1;
+  const SubjectChar first_char = static_cast<SubjectChar>(pattern[0]);
+  const SubjectChar last_char = static_cast<SubjectChar>(pattern[last_offset]);
+  const int max_n = subject.length() - pattern.length() + 1;
+  int pos = index;
+
+#if defined(V8_TARGET_LITTLE_ENDIAN) && V8_HOST_ARCH_64_BIT
+  using U = WordUnits<SubjectChar>;
+  using Word = typename U::Word;
+  const Word first_chars = U::kOnes * first_char;
+  const Word last_chars = U::kOnes * last_char;
+  for (; pos + U::kPerWord <= max_n; pos += U::kPerWord) {
+    Word matches = U::Zero((U::Load(subject.begin() + pos) ^ first_chars) |
+                           (U::Load(subject.begin() + pos + last_offset) ^
+                            last_chars));
+    if (matches != 0) return pos + U::IndexOfFirst(matches);
+  }
+#endif  // defined(V8_TARGET_LITTLE_ENDIAN) && V8_HOST_ARCH_64_BIT
+
+  for (; pos < max_n; pos++) {
+    if (subject[pos] == first_char && subject[pos + last_offset] == last_char) {
+      return pos;
+    }
+  }
+  return -1;
+}
+
 //---------------------------------------------------------------------
 // Single Character Pattern Search Strategy
 //---------------------------------------------------------------------
@@ -268,8 +311,11 @@ int StringSearch<PatternChar, SubjectChar>::LinearSearch(
   int pattern_length = pattern.length();
   int i = index;
   int n = subject.length() - pattern_length;
+  int misses = 0;
   while (i <= n) {
-    i = FindFirstCharacter(pattern, subject, i);
+    i = misses < kMaxFirstCharacterMisses
+            ? FindFirstCharacter(pattern, subject, i)
+            : FindFirstAndLastCharacter(pattern, subject, i);
     if (i == -1) return -1;
     DCHECK_LE(i, n);
     i++;
@@ -279,6 +325,7 @@ int StringSearch<PatternChar, SubjectChar>::LinearSearch(
                     pattern_length - 1)) {
       return i - 1;
     }
+    misses++;
   }
   return -1;
 }
@@ -498,13 +545,16 @@ int StringSearch<PatternChar, SubjectChar>::InitialSearch(
   // done enough work we decide it's probably worth switching to a better
   // algorithm.
   int badness = -10 - (pattern_length << 2);
+  int misses = 0;
 
   // We know our pattern is at least 2 characters, we cache the first so
   // the common case of the first character not matching is faster.
   for (int i = index, n = subject.length() - pattern_length; i <= n; i++) {
     badness++;
     if (badness <= 0) {
-      i = FindFirstCharacter(pattern, subject, i);
+      i = misses < kMaxFirstCharacterMisses
+              ? FindFirstCharacter(pattern, subject, i)
+              : FindFirstAndLastCharacter(pattern, subject, i);
       if (i == -1) return -1;
       DCHECK_LE(i, n);
       int j = 1;
@@ -518,6 +568,7 @@ int StringSearch<PatternChar, SubjectChar>::InitialSearch(
         return i;
       }
       badness += j;
+      misses++;
     } else {
       search->PopulateBoyerMooreHorspoolTable();
       search->strategy_ = &BoyerMooreHorspoolSearch;
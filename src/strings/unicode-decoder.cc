@@ -24,6 +24,23 @@ Utf8Decoder::Utf8Decoder(const Vector<const uint8_t>& chars)
   unibrow::Utf8::State state = unibrow::Utf8::State::kAccept;
 
   while (cursor < end) {
+    if (V8_LIKELY(state == unibrow::Utf8::State::kAccept)) {
+      if (*cursor <= unibrow::Utf8::kMaxOneByteChar) {
+        // Skip over the ASCII run this character starts.
+        int ascii_length =
+            1 + NonAsciiStart(cursor + 1, static_cast<int>(end - cursor - 1));
+        cursor += ascii_length;
+        utf16_length_ += ascii_length;
+        continue;
+      }
+      unibrow::uchar t =
+          unibrow::Utf8::ValueOfTwoOrThreeByteSequence(&cursor, end);
+      if (t != unibrow::Utf8::kIncomplete) {
+        is_one_byte = is_one_byte && t <= unibrow::Latin1::kMaxChar;
+        utf16_length_++;
+        continue;
+      }
+    }
     unibrow::uchar t =
         unibrow::Utf8::ValueOfIncremental(&cursor, &state, &incomplete_char);
     if (t != unibrow::Utf8::kIncomplete) {
@@ -55,6 +72,22 @@ void Utf8Decoder::Decode(Char* out, const Vector<const uint8_t>& data) {
   const uint8_t* end = data.begin() + data.length();
 
   while (cursor < end) {
+    if (V8_LIKELY(state == unibrow::Utf8::State::kAccept)) {
+      if (*cursor <= unibrow::Utf8::kMaxOneByteChar) {
+        int ascii_length =
+            1 + NonAsciiStart(cursor + 1, static_cast<int>(end - cursor - 1));
+        CopyChars(out, cursor, ascii_length);
+        cursor += ascii_length;
+        out += ascii_length;
+        continue;
+      }
+      unibrow::uchar t =
+          unibrow::Utf8::ValueOfTwoOrThreeByteSequence(&cursor, end);
+      if (t != unibrow::Utf8::kIncomplete) {
+        *(out++) = static_cast<Char>(t);
+        continue;
+      }
+    }
     unibrow::uchar t =
         unibrow::Utf8::ValueOfIncremental(&cursor, &state, &incomplete_char);
     if (t != unibrow::Utf8::kIncomplete) {
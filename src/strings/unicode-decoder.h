@@ -30,6 +30,14 @@ inline int NonAsciiStart(const uint8_t* chars, int length) {
     // Check aligned words.
     DCHECK_EQ(unibrow::Utf8::kMaxOneByteChar, 0x7F);
     const uintptr_t non_one_byte_mask = kUintptrAllBitsSet / 0xFF * 0x80;
+    // Check four words per iteration in long runs.
+    while (chars + 4 * sizeof(uintptr_t) <= limit) {
+      const uintptr_t* words = reinterpret_cast<const uintptr_t*>(chars);
+      if ((words[0] | words[1] | words[2] | words[3]) & non_one_byte_mask) {
+        break;
+      }
+      chars += 4 * sizeof(uintptr_t);
+    }
     while (chars + sizeof(uintptr_t) <= limit) {
       if (*reinterpret_cast<const uintptr_t*>(chars) & non_one_byte_mask) {
         return static_cast<int>(chars - start);
@@ -126,6 +126,32 @@ uchar Utf8::ValueOfIncremental(const byte** cursor, State* state,
   }
 }
 
+uchar Utf8::ValueOfTwoOrThreeByteSequence(const byte** cursor,
+                                          const byte* end) {
+  const byte* bytes = *cursor;
+  DCHECK_LT(bytes, end);
+  const byte lead = bytes[0];
+  auto is_continuation = [](byte b) { return (b & 0xC0) == 0x80; };
+  if (lead >= 0xC2 && lead <= 0xDF) {
+    if (end - bytes < 2 || !is_continuation(bytes[1])) return kIncomplete;
+    *cursor += 2;
+    return ((lead & 0x1F) << 6) | (bytes[1] & 0x3F);
+  }
+  if ((lead & 0xF0) == 0xE0) {
+    if (end - bytes < 3 || !is_continuation(bytes[1]) ||
+        !is_continuation(bytes[2])) {
+      return kIncomplete;
+    }
+    uchar c = ((lead & 0x0F) << 12) | ((bytes[1] & 0x3F) << 6) |
+              (bytes[2] & 0x3F);
+    // Overlong encodings and surrogates are errors.
+    if (c <= kMaxTwoByteChar || (c & 0xF800) == 0xD800) return kIncomplete;
+    *cursor += 3;
+    return c;
+  }
+  return kIncomplete;
+}
+
 unsigned Utf8::EncodeOneByte(char* str, uint8_t c) {
   static const int kMask = ~(1 << 6);
   if (c <= kMaxOneByteChar) {
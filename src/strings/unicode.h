@@ -185,6 +185,12 @@ class V8_EXPORT_PRIVATE Utf8 {
   static inline uchar ValueOfIncremental(const byte** cursor, State* state,
                                          Utf8IncrementalBuffer* buffer);
   static uchar ValueOfIncrementalFinish(State* state);
+  // Fast path for incremental decoding in the accept state: decodes the
+  // complete and valid two or three byte sequence at {*cursor}, and advances
+  // {*cursor} past it. Returns kIncomplete and leaves {*cursor} unchanged for
+  // anything else, which has to go through ValueOfIncremental.
+  static inline uchar ValueOfTwoOrThreeByteSequence(const byte** cursor,
+                                                   const byte* end);
 
   // Excludes non-characters from the set of valid code points.
   static inline bool IsValidCharacter(uchar c);
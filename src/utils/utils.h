@@ -346,7 +346,20 @@ inline bool CompareCharsEqualUnsigned(const lchar* lhs, const rchar* rhs,
     // two-byte char comparison is little- or big-endian.
     return memcmp(lhs, rhs, chars * sizeof(*lhs)) == 0;
   }
-  for (const lchar* limit = lhs + chars; lhs < limit; ++lhs, ++rhs) {
+  // Compare blocks of characters without an early exit, which compilers turn
+  // into vector code, and only check for differences after each block.
+  const size_t kBlockSize = 16;
+  const lchar* limit = lhs + chars;
+  // Don't form pointers past {limit}, which is undefined behavior.
+  for (; static_cast<size_t>(limit - lhs) >= kBlockSize;
+       lhs += kBlockSize, rhs += kBlockSize) {
+    uint32_t difference = 0;
+    for (size_t i = 0; i < kBlockSize; i++) {
+      difference |= static_cast<uint32_t>(lhs[i]) ^ rhs[i];
+    }
+    if (difference != 0) return false;
+  }
+  for (; lhs < limit; ++lhs, ++rhs) {
     if (*lhs != *rhs) return false;
   }
   return true;
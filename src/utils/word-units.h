@@ -0,0 +1,92 @@
+// Copyright 2021 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_UTILS_WORD_UNITS_H_
+#define V8_UTILS_WORD_UNITS_H_
+
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+
+#include "src/base/bits.h"
+#include "src/base/memory.h"
+#include "src/common/globals.h"
+
+namespace v8 {
+namespace internal {
+
+// Arithmetic on all code units of a machine word at once.
+//
+// V8 doesn't use SIMD intrinsics outside of its code generators, so hot
+// loops over strings instead load a word of code units at a time, classify
+// all of its units with plain integer arithmetic, and only look at the
+// units of words that contain one of interest.
+//
+// The classifications below set the highest bit of every code unit for
+// which a condition holds and clear all other bits. They never carry or
+// borrow from one unit into its neighbour, so, unlike the usual tricks based
+// on subtraction, there are no false positives: a flagged unit always
+// satisfies the condition.
+template <typename Char>
+struct WordUnits final : public AllStatic {
+  static_assert(std::is_unsigned<Char>::value, "code units are unsigned");
+
+  using Word = uintptr_t;
+
+  static constexpr int kPerWord = sizeof(Word) / sizeof(Char);
+  static constexpr int kBitsPerUnit = kBitsPerByte * sizeof(Char);
+  // The lowest bit of every unit.
+  static constexpr Word kOnes =
+      std::numeric_limits<Word>::max() / std::numeric_limits<Char>::max();
+  // The highest bit of a unit, and of every unit.
+  static constexpr Word kHighBit = Word{1} << (kBitsPerUnit - 1);
+  static constexpr Word kHighBits = kOnes * kHighBit;
+  // All bits but the highest of every unit.
+  static constexpr Word kLowBits = ~kHighBits;
+
+  V8_INLINE static Word Load(const Char* at) {
+    return base::ReadUnalignedValue<Word>(reinterpret_cast<Address>(at));
+  }
+
+  // Flags the units that are zero.
+  V8_INLINE static Word Zero(Word word) {
+    return ~(((word & kLowBits) + kLowBits) | word) & kHighBits;
+  }
+
+  // Flags the units that are equal to {c}.
+  V8_INLINE static Word Equal(Word word, uint32_t c) {
+    return Zero(word ^ (kOnes * c));
+  }
+
+  // Flags the units that are at least {c}, where c <= kHighBit.
+  V8_INLINE static Word AtLeast(Word word, uint32_t c) {
+    return (((word & kLowBits) + kOnes * (kHighBit - c)) | word) & kHighBits;
+  }
+
+  // Flags the units that are below {c}, where c <= kHighBit.
+  V8_INLINE static Word Below(Word word, uint32_t c) {
+    return AtLeast(word, c) ^ kHighBits;
+  }
+
+  // Flags the units in the range [lo, hi], where hi < kHighBit.
+  V8_INLINE static Word InRange(Word word, uint32_t lo, uint32_t hi) {
+    return AtLeast(word, lo) & ~AtLeast(word, hi + 1);
+  }
+
+  // Flags the units that aren't ASCII.
+  V8_INLINE static Word NonAscii(Word word) { return AtLeast(word, 0x80); }
+
+#if defined(V8_TARGET_LITTLE_ENDIAN)
+  // Returns the index in the word of the first flagged unit of {flags},
+  // which must not be zero.
+  V8_INLINE static int IndexOfFirst(Word flags) {
+    return base::bits::CountTrailingZeros(flags) / kBitsPerUnit;
+  }
+#endif  // defined(V8_TARGET_LITTLE_ENDIAN)
+};
+
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_UTILS_WORD_UNITS_H_
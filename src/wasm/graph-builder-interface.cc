@@ -1178,7 +1178,8 @@ class WasmGraphBuildingInterface {
     switch (call_mode) {
       case kIndirect:
         BUILD(CallIndirect, table_index, sig_index, VectorOf(arg_nodes),
-              VectorOf(return_nodes), decoder->position());
+              VectorOf(return_nodes), decoder->position(),
+              current_catch_ != kNullCatch);
         break;
       case kDirect:
         BUILD(CallDirect, sig_index, VectorOf(arg_nodes),
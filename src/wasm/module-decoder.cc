@@ -927,6 +927,40 @@ class ModuleDecoderImpl : public Decoder {
         init->entries.push_back(index);
       }
     }
+    if (ok()) ComputeSpeculativeCallIndirectTargets();
+  }
+
+  // The element section precedes the code section, so this is computed before
+  // any function gets compiled, also when streaming.
+  void ComputeSpeculativeCallIndirectTargets() {
+    constexpr int32_t kNone = WasmModule::kNoSpeculativeTarget;
+    constexpr int32_t kConflict = -2;
+    std::vector<int32_t>& targets = module_->speculative_call_indirect_targets;
+    targets.assign(module_->signature_map.size(), int32_t{kNone});
+    for (const WasmElemSegment& segment : module_->elem_segments) {
+      if (segment.status == WasmElemSegment::kStatusDeclarative) continue;
+      if (segment.status == WasmElemSegment::kStatusActive &&
+          segment.table_index != 0) {
+        continue;
+      }
+      for (uint32_t func_index : segment.entries) {
+        if (func_index == WasmElemSegment::kNullIndex) continue;
+        const WasmFunction& function = module_->functions[func_index];
+        uint32_t sig_id = module_->canonicalized_type_ids[function.sig_index];
+        DCHECK_LT(sig_id, targets.size());
+        int32_t& target = targets[sig_id];
+        if (function.imported) {
+          target = kConflict;
+        } else if (target == kNone) {
+          target = static_cast<int32_t>(func_index);
+        } else if (target != static_cast<int32_t>(func_index)) {
+          target = kConflict;
+        }
+      }
+    }
+    for (int32_t& target : targets) {
+      if (target == kConflict) target = kNone;
+    }
   }
 
   void DecodeCodeSection(bool verify_functions) {
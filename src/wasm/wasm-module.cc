@@ -624,7 +624,8 @@ size_t EstimateStoredSize(const WasmModule* module) {
          VectorSize(module->functions) + VectorSize(module->data_segments) +
          VectorSize(module->tables) + VectorSize(module->import_table) +
          VectorSize(module->export_table) + VectorSize(module->exceptions) +
-         VectorSize(module->elem_segments);
+         VectorSize(module->elem_segments) +
+         VectorSize(module->speculative_call_indirect_targets);
 }
 
 size_t PrintSignature(Vector<char> buffer, const wasm::FunctionSig* sig,
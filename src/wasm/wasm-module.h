@@ -347,6 +347,12 @@ struct V8_EXPORT_PRIVATE WasmModule {
   std::vector<WasmElemSegment> elem_segments;
   std::vector<WasmCompilationHint> compilation_hints;
   SignatureMap signature_map;  // canonicalizing map for signature indexes.
+  // Map from each canonical signature index to the only declared function of
+  // that signature which element segments can store into table 0, or
+  // {kNoSpeculativeTarget} if there is none or more than one. Used to guard
+  // direct calls at {call_indirect} sites in optimized code.
+  static constexpr int32_t kNoSpeculativeTarget = -1;
+  std::vector<int32_t> speculative_call_indirect_targets;
 
   ModuleOrigin origin = kWasmOrigin;  // origin of the module
   LazilyGeneratedNames lazily_generated_names;
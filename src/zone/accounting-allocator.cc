@@ -6,10 +6,12 @@
 
 #include <memory>
 
+#include "src/base/bits.h"
 #include "src/base/bounded-page-allocator.h"
 #include "src/base/logging.h"
 #include "src/base/macros.h"
 #include "src/base/platform/wrappers.h"
+#include "src/flags/flags.h"
 #include "src/utils/allocation.h"
 #include "src/zone/zone-compression.h"
 #include "src/zone/zone-segment.h"
@@ -75,7 +77,7 @@ AccountingAllocator::AccountingAllocator() {
   }
 }
 
-AccountingAllocator::~AccountingAllocator() = default;
+AccountingAllocator::~AccountingAllocator() { ReleasePooledSegments(); }
 
 Segment* AccountingAllocator::AllocateSegment(size_t bytes,
                                               bool supports_compression) {
@@ -85,6 +87,9 @@ Segment* AccountingAllocator::AllocateSegment(size_t bytes,
     memory = AllocatePages(bounded_page_allocator_.get(), nullptr, bytes,
                            kZonePageSize, PageAllocator::kReadWrite);
 
+  } else if (Segment* pooled = TryGetPooledSegment(bytes)) {
+    bytes = pooled->total_size();
+    memory = pooled;
   } else {
     memory = AllocWithRetry(bytes);
   }
@@ -106,13 +111,66 @@ void AccountingAllocator::ReturnSegment(Segment* segment,
   segment->ZapContents();
   size_t segment_size = segment->total_size();
   current_memory_usage_.fetch_sub(segment_size, std::memory_order_relaxed);
-  segment->ZapHeader();
   if (COMPRESS_ZONES_BOOL && supports_compression) {
+    segment->ZapHeader();
     CHECK(FreePages(bounded_page_allocator_.get(), segment, segment_size));
-  } else {
+  } else if (!TryPoolSegment(segment)) {
+    segment->ZapHeader();
     base::Free(segment);
   }
 }
 
+void AccountingAllocator::ReleasePooledSegments() {
+  base::MutexGuard guard(&pool_mutex_);
+  for (Segment*& bucket : pool_) {
+    while (bucket != nullptr) {
+      Segment* segment = bucket;
+      bucket = segment->next();
+      current_pool_size_.fetch_sub(segment->total_size(),
+                                   std::memory_order_relaxed);
+      segment->ZapHeader();
+      base::Free(segment);
+    }
+  }
+  DCHECK_EQ(0, GetCurrentPoolSize());
+}
+
+Segment* AccountingAllocator::TryGetPooledSegment(size_t bytes) {
+  if (bytes > size_t{1} << kMaxPooledSegmentSizeLog2) return nullptr;
+  size_t rounded = base::bits::RoundUpToPowerOfTwo(
+      std::max(bytes, size_t{1} << kMinPooledSegmentSizeLog2));
+  int index = base::bits::WhichPowerOfTwo(rounded) - kMinPooledSegmentSizeLog2;
+
+  base::MutexGuard guard(&pool_mutex_);
+  Segment* segment = pool_[index];
+  if (segment == nullptr) return nullptr;
+  pool_[index] = segment->next();
+  current_pool_size_.fetch_sub(segment->total_size(),
+                               std::memory_order_relaxed);
+  DCHECK_GE(segment->total_size(), bytes);
+  return segment;
+}
+
+bool AccountingAllocator::TryPoolSegment(Segment* segment) {
+  size_t size = segment->total_size();
+  if (size < size_t{1} << kMinPooledSegmentSizeLog2 ||
+      size > size_t{1} << kMaxPooledSegmentSizeLog2) {
+    return false;
+  }
+  int index = base::bits::WhichPowerOfTwo(base::bits::RoundDownToPowerOfTwo32(
+                  static_cast<uint32_t>(size))) -
+              kMinPooledSegmentSizeLog2;
+
+  base::MutexGuard guard(&pool_mutex_);
+  size_t pool_size = current_pool_size_.load(std::memory_order_relaxed);
+  size_t max_pool_size = static_cast<size_t>(FLAG_zone_segment_pool_size) * KB;
+  if (pool_size + size > max_pool_size) return false;
+  segment->set_zone(nullptr);
+  segment->set_next(pool_[index]);
+  pool_[index] = segment;
+  current_pool_size_.store(pool_size + size, std::memory_order_relaxed);
+  return true;
+}
+
 }  // namespace internal
 }  // namespace v8
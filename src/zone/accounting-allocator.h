@@ -9,6 +9,7 @@
 #include <memory>
 
 #include "src/base/macros.h"
+#include "src/base/platform/mutex.h"
 #include "src/logging/tracing-flags.h"
 
 namespace v8 {
@@ -37,10 +38,17 @@ class V8_EXPORT_PRIVATE AccountingAllocator {
   // them if the pool is already full or memory pressure is high.
   void ReturnSegment(Segment* memory, bool supports_compression);
 
+  // Releases all segments in the pool, e.g. under memory pressure.
+  void ReleasePooledSegments();
+
   size_t GetCurrentMemoryUsage() const {
     return current_memory_usage_.load(std::memory_order_relaxed);
   }
 
+  size_t GetCurrentPoolSize() const {
+    return current_pool_size_.load(std::memory_order_relaxed);
+  }
+
   size_t GetMaxMemoryUsage() const {
     return max_memory_usage_.load(std::memory_order_relaxed);
   }
@@ -66,9 +74,28 @@ class V8_EXPORT_PRIVATE AccountingAllocator {
   virtual void TraceAllocateSegmentImpl(Segment* segment) {}
 
  private:
+  // Freed segments of the common zone segment sizes are kept in a pool of
+  // free lists, one for each power of two in
+  // [2^kMinPooledSegmentSizeLog2, 2^kMaxPooledSegmentSizeLog2], so that the
+  // zones of subsequent compilations reuse them instead of going back to
+  // malloc. A segment is pooled by the largest power of two it can serve.
+  static constexpr int kMinPooledSegmentSizeLog2 = 13;  // 8 KB
+  static constexpr int kMaxPooledSegmentSizeLog2 = 15;  // 32 KB
+  static constexpr int kNumberOfPoolBuckets =
+      kMaxPooledSegmentSizeLog2 - kMinPooledSegmentSizeLog2 + 1;
+
+  // Returns a pooled segment of at least {bytes} bytes, or nullptr.
+  Segment* TryGetPooledSegment(size_t bytes);
+  // Returns true if {segment} was added to the pool.
+  bool TryPoolSegment(Segment* segment);
+
   std::atomic<size_t> current_memory_usage_{0};
   std::atomic<size_t> max_memory_usage_{0};
 
+  base::Mutex pool_mutex_;
+  Segment* pool_[kNumberOfPoolBuckets] = {};
+  std::atomic<size_t> current_pool_size_{0};
+
   std::unique_ptr<VirtualMemory> reserved_area_;
   std::unique_ptr<base::BoundedPageAllocator> bounded_page_allocator_;
 };
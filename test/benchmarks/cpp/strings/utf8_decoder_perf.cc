@@ -0,0 +1,64 @@
+// Copyright 2021 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Throughput of Utf8Decoder, which backs String::NewFromUtf8, on inputs that
+// exercise its different paths: pure ASCII, Latin-1 text (two-byte
+// sequences between ASCII runs), CJK text (three-byte sequences only) and
+// text with a few emoji (four-byte sequences, which go through the
+// incremental decoder). Each benchmark measures both the length computation
+// in the constructor and the decoding into a buffer of the resulting
+// encoding, and reports the UTF-8 bytes processed per second.
+
+#include <memory>
+#include <string>
+
+#include "src/strings/unicode-decoder.h"
+#include "third_party/google_benchmark/src/include/benchmark/benchmark.h"
+
+namespace v8 {
+namespace internal {
+namespace {
+
+// About 64KB of input, built from repetitions of {fragment}.
+std::string Repeat(const char* fragment) {
+  constexpr size_t kInputSize = 64 * KB;
+  std::string input;
+  while (input.size() < kInputSize) input += fragment;
+  return input;
+}
+
+void BM_Utf8Decode(benchmark::State& state, const char* fragment) {
+  const std::string input = Repeat(fragment);
+  Vector<const uint8_t> data(reinterpret_cast<const uint8_t*>(input.data()),
+                             input.size());
+  std::unique_ptr<uint16_t[]> buffer(new uint16_t[input.size()]);
+
+  for (auto _ : state) {
+    Utf8Decoder decoder(data);
+    if (decoder.is_one_byte()) {
+      decoder.Decode(reinterpret_cast<uint8_t*>(buffer.get()), data);
+    } else {
+      decoder.Decode(buffer.get(), data);
+    }
+    benchmark::DoNotOptimize(buffer.get());
+    benchmark::ClobberMemory();
+  }
+
+  state.SetBytesProcessed(state.iterations() * input.size());
+}
+
+BENCHMARK_CAPTURE(BM_Utf8Decode, Ascii,
+                  "The quick brown fox jumps over the lazy dog. ");
+BENCHMARK_CAPTURE(BM_Utf8Decode, Latin1,
+                  "Un caf\xC3\xA9 d\xC3\xA9\xC3\xA7u \xC3\xA0 la "
+                  "cr\xC3\xA8me br\xC3\xBBl\xC3\xA9\x65 de No\xC3\xABl. ");
+BENCHMARK_CAPTURE(BM_Utf8Decode, Cjk,
+                  "\xE6\x97\xA5\xE6\x9C\xAC\xE8\xAA\x9E\xE3\x81\xAE"
+                  "\xE6\x96\x87\xE7\xAB\xA0\xE3\x80\x82");
+BENCHMARK_CAPTURE(BM_Utf8Decode, MostlyAsciiWithEmoji,
+                  "Ship it \xF0\x9F\x9A\x80 and move on. ");
+
+}  // namespace
+}  // namespace internal
+}  // namespace v8
@@ -0,0 +1,366 @@
+// Copyright 2021 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Compile-time throughput of the wasm function body decoder, Liftoff and
+// TurboFan on synthetic modules. Each module consists of many functions
+// dominated by a single class of opcodes. Reported are
+//  - bytes_per_second: function body bytes processed per second,
+//  - ns_per_opcode: average time spent per opcode of the module,
+//  - zone_bytes_per_function: average peak zone memory used to process a
+//    function (not available for TurboFan, which allocates from the engine's
+//    allocator).
+
+#include <algorithm>
+#include <memory>
+
+#include "include/libplatform/libplatform.h"
+#include "include/v8.h"
+#include "src/base/platform/elapsed-timer.h"
+#include "src/compiler/wasm-compiler.h"
+#include "src/execution/isolate.h"
+#include "src/wasm/baseline/liftoff-compiler.h"
+#include "src/wasm/compilation-environment.h"
+#include "src/wasm/function-body-decoder.h"
+#include "src/wasm/module-decoder.h"
+#include "src/wasm/wasm-engine.h"
+#include "src/wasm/wasm-module-builder.h"
+#include "src/wasm/wasm-module.h"
+#include "src/wasm/wasm-opcodes.h"
+#include "src/zone/accounting-allocator.h"
+#include "src/zone/zone.h"
+#include "third_party/google_benchmark/src/include/benchmark/benchmark.h"
+
+namespace v8 {
+namespace internal {
+namespace wasm {
+namespace {
+
+constexpr int kNumFunctions = 100;
+// Number of opcode groups emitted per function (see {EmitGroup}).
+constexpr int kGroupsPerFunction = 200;
+
+enum class OpcodeClass {
+  kLocals,
+  kIntArith,
+  kFloatArith,
+  kMemory,
+  kControl,
+  kCalls
+};
+
+enum class Tier { kDecode, kLiftoff, kTurbofan };
+
+// The process-wide V8 setup. An isolate is only needed for the counters of
+// the module decoder; functions are compiled without one.
+class Environment {
+ public:
+  static Environment* Get() {
+    static Environment* environment = new Environment();
+    return environment;
+  }
+
+  Isolate* isolate() const { return reinterpret_cast<Isolate*>(isolate_); }
+  static const char* program_path;
+
+ private:
+  Environment() {
+    v8::V8::InitializeICUDefaultLocation(program_path);
+    v8::V8::InitializeExternalStartupData(program_path);
+    platform_ = v8::platform::NewDefaultPlatform();
+    v8::V8::InitializePlatform(platform_.get());
+    v8::V8::Initialize();
+    array_buffer_allocator_.reset(
+        v8::ArrayBuffer::Allocator::NewDefaultAllocator());
+    v8::Isolate::CreateParams create_params;
+    create_params.array_buffer_allocator = array_buffer_allocator_.get();
+    isolate_ = v8::Isolate::New(create_params);
+  }
+
+  std::unique_ptr<v8::Platform> platform_;
+  std::unique_ptr<v8::ArrayBuffer::Allocator> array_buffer_allocator_;
+  v8::Isolate* isolate_;
+};
+
+const char* Environment::program_path = nullptr;
+
+class ModuleWireBytesStorage final : public WireBytesStorage {
+ public:
+  explicit ModuleWireBytesStorage(Vector<const byte> bytes) : bytes_(bytes) {}
+
+  Vector<const uint8_t> GetCode(WireBytesRef ref) const final {
+    return bytes_.SubVector(ref.offset(), ref.end_offset());
+  }
+
+ private:
+  const Vector<const byte> bytes_;
+};
+
+// Function signature i_ii, shared by all functions of the module.
+constexpr ValueType kSigReps[] = {kWasmI32, kWasmI32, kWasmI32};
+FunctionSig sig_i_ii(1, 2, kSigReps);
+
+// Wraps a {WasmFunctionBuilder} and counts the emitted opcodes.
+class FunctionGenerator {
+ public:
+  explicit FunctionGenerator(WasmFunctionBuilder* builder)
+      : builder_(builder) {}
+
+  void Emit(WasmOpcode opcode) {
+    builder_->Emit(opcode);
+    num_opcodes_++;
+  }
+  void EmitWithU8(WasmOpcode opcode, byte immediate) {
+    builder_->EmitWithU8(opcode, immediate);
+    num_opcodes_++;
+  }
+  void EmitWithU8U8(WasmOpcode opcode, byte imm1, byte imm2) {
+    builder_->EmitWithU8U8(opcode, imm1, imm2);
+    num_opcodes_++;
+  }
+  void EmitGetLocal(uint32_t index) {
+    builder_->EmitGetLocal(index);
+    num_opcodes_++;
+  }
+  void EmitSetLocal(uint32_t index) {
+    builder_->EmitSetLocal(index);
+    num_opcodes_++;
+  }
+  void EmitI32Const(int32_t value) {
+    builder_->EmitI32Const(value);
+    num_opcodes_++;
+  }
+  void EmitF64Const(double value) {
+    builder_->EmitF64Const(value);
+    num_opcodes_++;
+  }
+  void EmitCall(uint32_t function_index) {
+    builder_->EmitWithU32V(kExprCallFunction, function_index);
+    num_opcodes_++;
+  }
+
+  size_t num_opcodes() const { return num_opcodes_; }
+
+ private:
+  WasmFunctionBuilder* const builder_;
+  size_t num_opcodes_ = 0;
+};
+
+// Parameters are locals 0 and 1; local 2 is an i32, local 3 an f64.
+void EmitGroup(FunctionGenerator* gen, OpcodeClass opcode_class, int i,
+               uint32_t callee_index) {
+  switch (opcode_class) {
+    case OpcodeClass::kLocals:
+      gen->EmitGetLocal(i % 2);
+      gen->EmitSetLocal(2);
+      gen->EmitGetLocal(2);
+      gen->EmitSetLocal(i % 2);
+      break;
+    case OpcodeClass::kIntArith:
+      gen->EmitGetLocal(2);
+      gen->EmitGetLocal(0);
+      gen->Emit(kExprI32Add);
+      gen->EmitGetLocal(1);
+      gen->Emit(kExprI32Mul);
+      gen->EmitI32Const(i);
+      gen->Emit(kExprI32Xor);
+      gen->EmitI32Const(3);
+      gen->Emit(kExprI32ShrU);
+      gen->EmitSetLocal(2);
+      break;
+    case OpcodeClass::kFloatArith:
+      gen->EmitGetLocal(3);
+      gen->EmitF64Const(1.5);
+      gen->Emit(kExprF64Mul);
+      gen->EmitGetLocal(3);
+      gen->Emit(kExprF64Add);
+      gen->Emit(kExprF64Sqrt);
+      gen->EmitSetLocal(3);
+      break;
+    case OpcodeClass::kMemory:
+      gen->EmitGetLocal(0);
+      gen->EmitGetLocal(1);
+      gen->EmitWithU8U8(kExprI32LoadMem, 2, static_cast<byte>(i % 32 * 4));
+      gen->EmitWithU8U8(kExprI32StoreMem, 2,
+                        static_cast<byte>((i + 1) % 32 * 4));
+      break;
+    case OpcodeClass::kControl:
+      gen->EmitWithU8(kExprBlock, kVoidCode);
+      gen->EmitGetLocal(0);
+      gen->EmitWithU8(kExprBrIf, 0);
+      gen->EmitWithU8(kExprLoop, kVoidCode);
+      gen->EmitGetLocal(1);
+      gen->EmitWithU8(kExprIf, kVoidCode);
+      gen->EmitGetLocal(0);
+      gen->EmitWithU8(kExprBrIf, 2);
+      gen->Emit(kExprEnd);
+      gen->Emit(kExprEnd);
+      gen->Emit(kExprEnd);
+      break;
+    case OpcodeClass::kCalls:
+      gen->EmitGetLocal(0);
+      gen->EmitGetLocal(1);
+      gen->EmitCall(callee_index);
+      gen->EmitSetLocal(2);
+      break;
+  }
+}
+
+struct SyntheticModule {
+  std::unique_ptr<byte[]> bytes;
+  size_t length = 0;
+  std::shared_ptr<const WasmModule> module;
+  size_t num_opcodes = 0;
+  size_t code_size = 0;
+};
+
+SyntheticModule CreateModule(Isolate* isolate, OpcodeClass opcode_class) {
+  AccountingAllocator allocator;
+  Zone zone(&allocator, ZONE_NAME);
+  WasmModuleBuilder* builder = zone.New<WasmModuleBuilder>(&zone);
+  builder->SetMinMemorySize(1);
+
+  // Function 0 is the callee of {OpcodeClass::kCalls}.
+  WasmFunctionBuilder* callee = builder->AddFunction(&sig_i_ii);
+  {
+    FunctionGenerator gen(callee);
+    gen.EmitGetLocal(0);
+    gen.EmitGetLocal(1);
+    gen.Emit(kExprI32Add);
+    gen.Emit(kExprEnd);
+  }
+
+  size_t num_opcodes = 0;
+  for (int f = 0; f < kNumFunctions; f++) {
+    WasmFunctionBuilder* function = builder->AddFunction(&sig_i_ii);
+    function->AddLocal(kWasmI32);
+    function->AddLocal(kWasmF64);
+    FunctionGenerator gen(function);
+    for (int i = 0; i < kGroupsPerFunction; i++) {
+      EmitGroup(&gen, opcode_class, i, callee->func_index());
+    }
+    gen.EmitGetLocal(2);
+    gen.Emit(kExprEnd);
+    num_opcodes += gen.num_opcodes();
+  }
+
+  ZoneBuffer buffer(&zone);
+  builder->WriteTo(&buffer);
+
+  SyntheticModule result;
+  result.length = buffer.size();
+  result.bytes.reset(new byte[result.length]);
+  std::copy(buffer.begin(), buffer.end(), result.bytes.get());
+  ModuleResult decoding_result = DecodeWasmModule(
+      WasmFeatures::FromFlags(), result.bytes.get(),
+      result.bytes.get() + result.length, false, kWasmOrigin,
+      isolate->counters(), isolate->metrics_recorder(),
+      v8::metrics::Recorder::ContextId::Empty(), DecodingMethod::kSync,
+      isolate->wasm_engine()->allocator());
+  CHECK(decoding_result.ok());
+  result.module = std::move(decoding_result).value();
+  result.num_opcodes = num_opcodes;
+  for (const WasmFunction& function : result.module->functions) {
+    if (function.func_index == callee->func_index()) continue;
+    result.code_size += function.code.length();
+  }
+  return result;
+}
+
+void BM_CompileModule(benchmark::State& state, Tier tier,
+                      OpcodeClass opcode_class) {
+  Isolate* isolate = Environment::Get()->isolate();
+  SyntheticModule synthetic = CreateModule(isolate, opcode_class);
+  const WasmModule* module = synthetic.module.get();
+  ModuleWireBytesStorage wire_bytes(
+      VectorOf(synthetic.bytes.get(), synthetic.length));
+  WasmFeatures enabled = WasmFeatures::FromFlags();
+  CompilationEnv env(module, kNoTrapHandler, kRuntimeExceptionSupport,
+                     enabled);
+  WasmEngine* engine = isolate->wasm_engine();
+
+  size_t zone_bytes = 0;
+  size_t num_processed = 0;
+  base::ElapsedTimer timer;
+  timer.Start();
+  for (auto _ : state) {
+    for (const WasmFunction& function : module->functions) {
+      if (function.func_index == 0) continue;  // The callee.
+      FunctionBody body(function.sig, function.code.offset(),
+                        synthetic.bytes.get() + function.code.offset(),
+                        synthetic.bytes.get() + function.code.end_offset());
+      WasmFeatures detected;
+      AccountingAllocator allocator;
+      switch (tier) {
+        case Tier::kDecode: {
+          DecodeResult result =
+              VerifyWasmCode(&allocator, enabled, module, &detected, body);
+          CHECK(result.ok());
+          break;
+        }
+        case Tier::kLiftoff: {
+          WasmCompilationResult result = ExecuteLiftoffCompilation(
+              &allocator, &env, body, function.func_index, kNoDebugging,
+              nullptr, &detected);
+          CHECK(result.succeeded());
+          benchmark::DoNotOptimize(result.code_desc.buffer);
+          break;
+        }
+        case Tier::kTurbofan: {
+          WasmCompilationResult result =
+              compiler::ExecuteTurbofanWasmCompilation(
+                  engine, &env, body, function.func_index, &wire_bytes,
+                  nullptr, &detected);
+          CHECK(result.succeeded());
+          benchmark::DoNotOptimize(result.code_desc.buffer);
+          break;
+        }
+      }
+      zone_bytes += allocator.GetMaxMemoryUsage();
+      num_processed++;
+    }
+  }
+
+  double elapsed_ns = static_cast<double>(timer.Elapsed().InNanoseconds());
+
+  state.SetBytesProcessed(state.iterations() * synthetic.code_size);
+  state.counters["ns_per_opcode"] =
+      elapsed_ns / (state.iterations() * synthetic.num_opcodes);
+  if (tier != Tier::kTurbofan && num_processed > 0) {
+    state.counters["zone_bytes_per_function"] =
+        static_cast<double>(zone_bytes) / num_processed;
+  }
+}
+
+#define BENCHMARK_OPCODE_CLASSES(tier)                                 \
+  BENCHMARK_CAPTURE(BM_CompileModule, tier##_Locals, Tier::k##tier,    \
+                    OpcodeClass::kLocals);                             \
+  BENCHMARK_CAPTURE(BM_CompileModule, tier##_IntArith, Tier::k##tier,  \
+                    OpcodeClass::kIntArith);                           \
+  BENCHMARK_CAPTURE(BM_CompileModule, tier##_FloatArith, Tier::k##tier, \
+                    OpcodeClass::kFloatArith);                         \
+  BENCHMARK_CAPTURE(BM_CompileModule, tier##_Memory, Tier::k##tier,    \
+                    OpcodeClass::kMemory);                             \
+  BENCHMARK_CAPTURE(BM_CompileModule, tier##_Control, Tier::k##tier,   \
+                    OpcodeClass::kControl);                            \
+  BENCHMARK_CAPTURE(BM_CompileModule, tier##_Calls, Tier::k##tier,     \
+                    OpcodeClass::kCalls)
+
+BENCHMARK_OPCODE_CLASSES(Decode);
+BENCHMARK_OPCODE_CLASSES(Liftoff);
+BENCHMARK_OPCODE_CLASSES(Turbofan);
+
+#undef BENCHMARK_OPCODE_CLASSES
+
+}  // namespace
+}  // namespace wasm
+}  // namespace internal
+}  // namespace v8
+
+int main(int argc, char** argv) {
+  v8::internal::wasm::Environment::program_path = argv[0];
+  benchmark::Initialize(&argc, argv);
+  if (benchmark::ReportUnrecognizedArguments(argc, argv)) return 1;
+  benchmark::RunSpecifiedBenchmarks();
+  return 0;
+}
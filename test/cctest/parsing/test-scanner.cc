@@ -5,6 +5,9 @@
 // Tests v8::internal::Scanner. Note that presently most unit tests for the
 // Scanner are in cctest/test-parsing.cc, rather than here.
 
+#include <string>
+#include <vector>
+
 #include "src/handles/handles-inl.h"
 #include "src/objects/objects-inl.h"
 #include "src/parsing/parse-info.h"
@@ -105,5 +108,37 @@ TEST(AllThePushbacks) {
   }
 }
 
+TEST(LongRunsInOneByteSource) {
+  // Runs of identifier characters, whitespace and comments that don't fit
+  // into a single buffered block are scanned directly in one-byte sources.
+  // They must scan the same as in two-byte sources.
+  std::string long_name(2000, 'a');
+  std::string src = "/*" + std::string(1500, '-') + "\n" +
+                    std::string(1500, '*') + "*/ " + long_name + "\n" +
+                    std::string(1000, ' ') + "b //" + std::string(1500, 'x') +
+                    "\n" + std::string(700, ' ') + "/*\n*/" + long_name;
+
+  for (const std::string& source : {src, src + "/* unterminated"}) {
+    auto one_byte = make_scanner(source.c_str());
+    std::vector<uint16_t> two_byte_source(source.begin(), source.end());
+    std::unique_ptr<Utf16CharacterStream> two_byte_stream =
+        ScannerStream::ForTesting(two_byte_source.data(),
+                                  two_byte_source.size());
+    Scanner two_byte(two_byte_stream.get(),
+                     UnoptimizedCompileFlags::ForTest(CcTest::i_isolate()));
+    two_byte.Initialize();
+
+    Token::Value token;
+    do {
+      token = one_byte->Next();
+      CHECK_TOK(two_byte.Next(), token);
+      CHECK_EQ(two_byte.location().beg_pos, one_byte->location().beg_pos);
+      CHECK_EQ(two_byte.location().end_pos, one_byte->location().end_pos);
+      CHECK_EQ(two_byte.HasLineTerminatorBeforeNext(),
+               one_byte->HasLineTerminatorBeforeNext());
+    } while (token != Token::EOS && token != Token::ILLEGAL);
+  }
+}
+
 }  // namespace internal
 }  // namespace v8
@@ -38,6 +38,7 @@
 #endif
 
 #include "include/v8-fast-api-calls.h"
+#include "include/v8-profiler.h"
 #include "include/v8-util.h"
 #include "src/api/api-inl.h"
 #include "src/base/overflowing-math.h"
@@ -21079,6 +21080,21 @@ THREADED_TEST(JSONParseNumber) {
   ExpectString("JSON.stringify(obj)", "42");
 }
 
+THREADED_TEST(JSONParseTaskOnIsolateThread) {
+  LocalContext context;
+  HandleScope scope(context->GetIsolate());
+  // Running the task on the isolate's thread leaves all of the parsing to
+  // FinishParse.
+  std::unique_ptr<v8::JSON::ParseTask> task = v8::JSON::StartParse(
+      context->GetIsolate(), v8_str("{\"x\":[42,\"y\",1.5]}"));
+  task->Run();
+  Local<Value> obj =
+      v8::JSON::FinishParse(context.local(), std::move(task)).ToLocalChecked();
+  Local<Object> global = context->Global();
+  global->Set(context.local(), v8_str("obj"), obj).FromJust();
+  ExpectString("JSON.stringify(obj)", "{\"x\":[42,\"y\",1.5]}");
+}
+
 namespace {
 void TestJSONParseArray(Local<Context> context, const char* input_str,
                         const char* expected_output_str,
@@ -21144,6 +21160,137 @@ THREADED_TEST(JSONStringifyObjectWithGap) {
   ExpectString("JSON.stringify(obj, null,  '*')", *utf8);
 }
 
+namespace {
+
+class JSONCollectingStream : public v8::OutputStream {
+ public:
+  explicit JSONCollectingStream(int chunk_size, int abort_after = -1)
+      : chunk_size_(chunk_size), abort_after_(abort_after) {}
+
+  void EndOfStream() override { ended_ = true; }
+  int GetChunkSize() override { return chunk_size_; }
+  WriteResult WriteAsciiChunk(char* data, int size) override {
+    CHECK(!ended_);
+    CHECK_LE(size, chunk_size_);
+    result_.append(data, size);
+    return ++chunks_ == abort_after_ ? kAbort : kContinue;
+  }
+
+  const std::string& result() const { return result_; }
+  int chunks() const { return chunks_; }
+  bool ended() const { return ended_; }
+
+ private:
+  const int chunk_size_;
+  const int abort_after_;
+  std::string result_;
+  int chunks_ = 0;
+  bool ended_ = false;
+};
+
+void TestJSONStringifyToStream(Local<Context> context, const char* source,
+                               int chunk_size) {
+  Local<Value> value = CompileRun(source);
+  Local<String> json =
+      v8::JSON::Stringify(context, value, v8_str("  ")).ToLocalChecked();
+  v8::String::Utf8Value expected(context->GetIsolate(), json);
+  JSONCollectingStream stream(chunk_size);
+  CHECK(v8::JSON::StringifyToStream(context, value, &stream, v8_str("  "))
+            .FromJust());
+  CHECK(stream.ended());
+  CHECK_EQ(std::string(*expected, expected.length()), stream.result());
+}
+
+}  // namespace
+
+THREADED_TEST(JSONStringifyToStream) {
+  LocalContext context;
+  HandleScope scope(context->GetIsolate());
+  TestJSONStringifyToStream(context.local(), "({x: 42, y: [1, 'a', null]})",
+                            1);
+  TestJSONStringifyToStream(context.local(), "'caf\\u00e9 \\u2603'", 3);
+  TestJSONStringifyToStream(context.local(),
+                            "['\\ud83d\\ude00'.repeat(10000), 'abc']", 7);
+  TestJSONStringifyToStream(
+      context.local(),
+      "Array.from({length: 10000}, (_, i) => ({i, s: '\\u00ff' + i}))", 1024);
+  TestJSONStringifyToStream(context.local(), "['\\ud800', 'x'.repeat(1e5)]",
+                            4096);
+}
+
+THREADED_TEST(JSONStringifyToStreamSurrogatesInGap) {
+  LocalContext context;
+  v8::Isolate* isolate = context->GetIsolate();
+  HandleScope scope(isolate);
+  // The gap is not escaped, so lone surrogates in it are written as U+FFFD.
+  struct {
+    const char* source;
+    uint16_t gap[3];
+    const char* expected;
+  } tests[] = {
+      {"[1]", {0xD800}, "[\n\xEF\xBF\xBD1\n]"},
+      {"[1]", {0xDC00}, "[\n\xEF\xBF\xBD1\n]"},
+      {"[1]", {0xDC00, 0xD800}, "[\n\xEF\xBF\xBD\xEF\xBF\xBD1\n]"},
+      {"[1]", {0xD83D, 0xDE00}, "[\n\xF0\x9F\x98\x80" "1\n]"},
+      {"[[]]", {0xD800}, "[\n\xEF\xBF\xBD[]\n]"},
+      {"[[1]]",
+       {0xD800},
+       "[\n\xEF\xBF\xBD[\n\xEF\xBF\xBD\xEF\xBF\xBD1\n\xEF\xBF\xBD]"
+       "\n]"},
+  };
+  for (const auto& test : tests) {
+    Local<Value> value = CompileRun(test.source);
+    Local<String> gap =
+        v8::String::NewFromTwoByte(isolate, test.gap).ToLocalChecked();
+    JSONCollectingStream stream(1);
+    CHECK(v8::JSON::StringifyToStream(context.local(), value, &stream, gap)
+              .FromJust());
+    CHECK(stream.ended());
+    CHECK_EQ(std::string(test.expected), stream.result());
+  }
+}
+
+THREADED_TEST(JSONStringifyToStreamNoResult) {
+  LocalContext context;
+  v8::Isolate* isolate = context->GetIsolate();
+  HandleScope scope(isolate);
+  JSONCollectingStream stream(16);
+  CHECK(!v8::JSON::StringifyToStream(context.local(), v8::Undefined(isolate),
+                                     &stream)
+             .FromJust());
+  CHECK(!stream.ended());
+  CHECK_EQ(0, stream.chunks());
+}
+
+THREADED_TEST(JSONStringifyToStreamAbort) {
+  LocalContext context;
+  HandleScope scope(context->GetIsolate());
+  Local<Value> value = CompileRun(
+      "var count = 0;"
+      "Array.from({length: 100000},"
+      "           () => ({toJSON() { count++; return 'abcdefgh'; }}))");
+  JSONCollectingStream stream(64, 2);
+  CHECK(!v8::JSON::StringifyToStream(context.local(), value, &stream)
+             .FromJust());
+  CHECK(!stream.ended());
+  CHECK_EQ(2, stream.chunks());
+  // Serialization stops soon after the stream aborts.
+  CHECK_GT(100000, CompileRun("count")->Int32Value(context.local()).FromJust());
+}
+
+THREADED_TEST(JSONStringifyToStreamException) {
+  LocalContext context;
+  HandleScope scope(context->GetIsolate());
+  Local<Value> value =
+      CompileRun("[1, {toJSON() { throw new Error('boom'); }}]");
+  v8::TryCatch try_catch(context->GetIsolate());
+  JSONCollectingStream stream(16);
+  CHECK(v8::JSON::StringifyToStream(context.local(), value, &stream)
+            .IsNothing());
+  CHECK(try_catch.HasCaught());
+  CHECK(!stream.ended());
+}
+
 #if V8_OS_POSIX
 class ThreadInterruptTest {
  public:
@@ -37,6 +37,7 @@
 #include "src/init/v8.h"
 #include "src/objects/js-regexp-inl.h"
 #include "src/objects/objects-inl.h"
+#include "src/regexp/regexp-bytecode-cache.h"
 #include "src/regexp/regexp-bytecode-generator.h"
 #include "src/regexp/regexp-bytecodes.h"
 #include "src/regexp/regexp-compiler.h"
@@ -2141,6 +2142,150 @@ TEST(PeepholeSkipUntilGtOrNotBitInTable) {
                           BC_SKIP_UNTIL_GT_OR_NOT_BIT_IN_TABLE)));
 }
 
+void CreatePeepholeSkipUntilNotCharBytecode(RegExpMacroAssembler* m) {
+  Label start;
+  m->Bind(&start);
+  m->LoadCurrentCharacter(0, nullptr, true);
+  m->CheckNotCharacter('x', nullptr);
+  m->AdvanceCurrentPosition(1);
+  m->GoTo(&start);
+}
+
+TEST(PeepholeSkipUntilNotChar) {
+  Zone zone(CcTest::i_isolate()->allocator(), ZONE_NAME);
+  Isolate* isolate = CcTest::i_isolate();
+  Factory* factory = isolate->factory();
+  HandleScope scope(isolate);
+
+  RegExpBytecodeGenerator orig(CcTest::i_isolate(), &zone);
+  RegExpBytecodeGenerator opt(CcTest::i_isolate(), &zone);
+
+  CreatePeepholeSkipUntilNotCharBytecode(&orig);
+  CreatePeepholeSkipUntilNotCharBytecode(&opt);
+
+  Handle<String> source = factory->NewStringFromStaticChars("dummy");
+
+  i::FLAG_regexp_peephole_optimization = false;
+  Handle<ByteArray> array = Handle<ByteArray>::cast(orig.GetCode(source));
+  int length = array->length();
+
+  i::FLAG_regexp_peephole_optimization = true;
+  Handle<ByteArray> array_optimized =
+      Handle<ByteArray>::cast(opt.GetCode(source));
+  int length_optimized = array_optimized->length();
+
+  int length_expected = RegExpBytecodeLength(BC_LOAD_CURRENT_CHAR) +
+                        RegExpBytecodeLength(BC_CHECK_NOT_CHAR) +
+                        RegExpBytecodeLength(BC_ADVANCE_CP_AND_GOTO) +
+                        RegExpBytecodeLength(BC_POP_BT);
+  int length_optimized_expected =
+      RegExpBytecodeLength(BC_SKIP_UNTIL_NOT_CHAR) +
+      RegExpBytecodeLength(BC_POP_BT);
+
+  CHECK_EQ(length, length_expected);
+  CHECK_EQ(length_optimized, length_optimized_expected);
+
+  CHECK_EQ(BC_SKIP_UNTIL_NOT_CHAR, array_optimized->get(0));
+  CHECK_EQ(BC_POP_BT, array_optimized->get(RegExpBytecodeLength(
+                          BC_SKIP_UNTIL_NOT_CHAR)));
+}
+
+void CreatePeepholeSkipUntilCharInRangeBytecode(RegExpMacroAssembler* m) {
+  Label start;
+  m->Bind(&start);
+  m->LoadCurrentCharacter(0, nullptr, true);
+  m->CheckCharacterInRange('a', 'z', nullptr);
+  m->AdvanceCurrentPosition(1);
+  m->GoTo(&start);
+}
+
+TEST(PeepholeSkipUntilCharInRange) {
+  Zone zone(CcTest::i_isolate()->allocator(), ZONE_NAME);
+  Isolate* isolate = CcTest::i_isolate();
+  Factory* factory = isolate->factory();
+  HandleScope scope(isolate);
+
+  RegExpBytecodeGenerator orig(CcTest::i_isolate(), &zone);
+  RegExpBytecodeGenerator opt(CcTest::i_isolate(), &zone);
+
+  CreatePeepholeSkipUntilCharInRangeBytecode(&orig);
+  CreatePeepholeSkipUntilCharInRangeBytecode(&opt);
+
+  Handle<String> source = factory->NewStringFromStaticChars("dummy");
+
+  i::FLAG_regexp_peephole_optimization = false;
+  Handle<ByteArray> array = Handle<ByteArray>::cast(orig.GetCode(source));
+  int length = array->length();
+
+  i::FLAG_regexp_peephole_optimization = true;
+  Handle<ByteArray> array_optimized =
+      Handle<ByteArray>::cast(opt.GetCode(source));
+  int length_optimized = array_optimized->length();
+
+  int length_expected = RegExpBytecodeLength(BC_LOAD_CURRENT_CHAR) +
+                        RegExpBytecodeLength(BC_CHECK_CHAR_IN_RANGE) +
+                        RegExpBytecodeLength(BC_ADVANCE_CP_AND_GOTO) +
+                        RegExpBytecodeLength(BC_POP_BT);
+  int length_optimized_expected =
+      RegExpBytecodeLength(BC_SKIP_UNTIL_CHAR_IN_RANGE) +
+      RegExpBytecodeLength(BC_POP_BT);
+
+  CHECK_EQ(length, length_expected);
+  CHECK_EQ(length_optimized, length_optimized_expected);
+
+  CHECK_EQ(BC_SKIP_UNTIL_CHAR_IN_RANGE, array_optimized->get(0));
+  CHECK_EQ(BC_POP_BT, array_optimized->get(RegExpBytecodeLength(
+                          BC_SKIP_UNTIL_CHAR_IN_RANGE)));
+}
+
+void CreatePeepholeSkipUntilCharNotInRangeBytecode(RegExpMacroAssembler* m) {
+  Label start;
+  m->Bind(&start);
+  m->LoadCurrentCharacter(0, nullptr, true);
+  m->CheckCharacterNotInRange('a', 'z', nullptr);
+  m->AdvanceCurrentPosition(1);
+  m->GoTo(&start);
+}
+
+TEST(PeepholeSkipUntilCharNotInRange) {
+  Zone zone(CcTest::i_isolate()->allocator(), ZONE_NAME);
+  Isolate* isolate = CcTest::i_isolate();
+  Factory* factory = isolate->factory();
+  HandleScope scope(isolate);
+
+  RegExpBytecodeGenerator orig(CcTest::i_isolate(), &zone);
+  RegExpBytecodeGenerator opt(CcTest::i_isolate(), &zone);
+
+  CreatePeepholeSkipUntilCharNotInRangeBytecode(&orig);
+  CreatePeepholeSkipUntilCharNotInRangeBytecode(&opt);
+
+  Handle<String> source = factory->NewStringFromStaticChars("dummy");
+
+  i::FLAG_regexp_peephole_optimization = false;
+  Handle<ByteArray> array = Handle<ByteArray>::cast(orig.GetCode(source));
+  int length = array->length();
+
+  i::FLAG_regexp_peephole_optimization = true;
+  Handle<ByteArray> array_optimized =
+      Handle<ByteArray>::cast(opt.GetCode(source));
+  int length_optimized = array_optimized->length();
+
+  int length_expected = RegExpBytecodeLength(BC_LOAD_CURRENT_CHAR) +
+                        RegExpBytecodeLength(BC_CHECK_CHAR_NOT_IN_RANGE) +
+                        RegExpBytecodeLength(BC_ADVANCE_CP_AND_GOTO) +
+                        RegExpBytecodeLength(BC_POP_BT);
+  int length_optimized_expected =
+      RegExpBytecodeLength(BC_SKIP_UNTIL_CHAR_NOT_IN_RANGE) +
+      RegExpBytecodeLength(BC_POP_BT);
+
+  CHECK_EQ(length, length_expected);
+  CHECK_EQ(length_optimized, length_optimized_expected);
+
+  CHECK_EQ(BC_SKIP_UNTIL_CHAR_NOT_IN_RANGE, array_optimized->get(0));
+  CHECK_EQ(BC_POP_BT, array_optimized->get(RegExpBytecodeLength(
+                          BC_SKIP_UNTIL_CHAR_NOT_IN_RANGE)));
+}
+
 void CreatePeepholeLabelFixupsInsideBytecode(RegExpMacroAssembler* m,
                                              Label* dummy_before,
                                              Label* dummy_after,
@@ -2367,6 +2512,31 @@ TEST(UnicodePropertyEscapeCodeSize) {
   }
 }
 
+TEST(SharedBytecodeCache) {
+  i::FlagScope<bool> f(&v8::internal::FLAG_regexp_interpret_all, true);
+  i::FlagScope<size_t> g(
+      &v8::internal::FLAG_regexp_shared_bytecode_cache_size, 4096);
+
+  // The second isolate reuses the bytecode compiled by the first one.
+  const char* source = "/(?<key>\\w+)=(\\d+)x/.exec('--key=42x').groups.key";
+  size_t hit_count = RegExpBytecodeCache::HitCountForTesting();
+  v8::Isolate::CreateParams create_params;
+  create_params.array_buffer_allocator = CcTest::array_buffer_allocator();
+  for (int i = 0; i < 2; i++) {
+    v8::Isolate* isolate = v8::Isolate::New(create_params);
+    {
+      v8::Isolate::Scope isolate_scope(isolate);
+      v8::HandleScope handle_scope(isolate);
+      v8::Local<v8::Context> context = v8::Context::New(isolate);
+      v8::Context::Scope context_scope(context);
+      v8::Local<v8::Value> result = CompileRun(source);
+      CHECK(result->StrictEquals(v8_str("key")));
+    }
+    isolate->Dispose();
+  }
+  CHECK_EQ(hit_count + 1, RegExpBytecodeCache::HitCountForTesting());
+}
+
 #undef CHECK_PARSE_ERROR
 #undef CHECK_SIMPLE
 #undef CHECK_MIN_MAX
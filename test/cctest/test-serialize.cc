@@ -2490,6 +2490,86 @@ TEST(CodeSerializerAfterExecute) {
   FLAG_always_opt = prev_always_opt_value;
 }
 
+TEST(CodeSerializerRecompileFlushed) {
+  // Functions whose bytecode was flushed before the cache is created are
+  // recompiled and cached, so running them again compiles nothing.
+  bool prev_opt_value = FLAG_opt;
+  bool prev_always_opt_value = FLAG_always_opt;
+  bool prev_flush_bytecode_value = FLAG_flush_bytecode;
+  bool prev_recompile_flushed_value = FLAG_code_cache_recompile_flushed;
+  FLAG_opt = false;
+  FLAG_always_opt = false;
+  FLAG_flush_bytecode = true;
+  FLAG_code_cache_recompile_flushed = true;
+  const char* source = "function f() { return 'abc'; }; f() + 'def'";
+  v8::ScriptCompiler::CachedData* cache;
+
+  v8::Isolate::CreateParams create_params;
+  create_params.array_buffer_allocator = CcTest::array_buffer_allocator();
+  v8::Isolate* isolate1 = v8::Isolate::New(create_params);
+  Isolate* i_isolate1 = reinterpret_cast<Isolate*>(isolate1);
+  {
+    v8::Isolate::Scope iscope(isolate1);
+    v8::HandleScope scope(isolate1);
+    v8::Local<v8::Context> context = v8::Context::New(isolate1);
+    v8::Context::Scope context_scope(context);
+
+    v8::ScriptOrigin origin(v8_str("test"));
+    v8::ScriptCompiler::Source source_with_origin(v8_str(source), origin);
+    v8::Local<v8::UnboundScript> script =
+        v8::ScriptCompiler::CompileUnboundScript(isolate1, &source_with_origin)
+            .ToLocalChecked();
+    script->BindToCurrentContext()->Run(context).ToLocalChecked();
+    Handle<JSFunction> f = Handle<JSFunction>::cast(v8::Utils::OpenHandle(
+        *context->Global()->Get(context, v8_str("f")).ToLocalChecked()));
+    CHECK(f->shared().is_compiled());
+
+    // Age the bytecode of f until it is flushed.
+    const int kAgingThreshold = 8;
+    for (int i = 0; i < kAgingThreshold; i++) {
+      i_isolate1->heap()->CollectAllGarbage(Heap::kNoGCFlags,
+                                            GarbageCollectionReason::kTesting);
+    }
+    CHECK(!f->shared().is_compiled());
+    CHECK(f->shared().has_flushed_bytecode());
+
+    cache = ScriptCompiler::CreateCodeCache(script);
+    CHECK(f->shared().is_compiled());
+  }
+  isolate1->Dispose();
+
+  v8::Isolate* isolate2 = v8::Isolate::New(create_params);
+  Isolate* i_isolate2 = reinterpret_cast<Isolate*>(isolate2);
+  {
+    v8::Isolate::Scope iscope(isolate2);
+    v8::HandleScope scope(isolate2);
+    v8::Local<v8::Context> context = v8::Context::New(isolate2);
+    v8::Context::Scope context_scope(context);
+
+    v8::ScriptOrigin origin(v8_str("test"));
+    v8::ScriptCompiler::Source source_with_cache(v8_str(source), origin, cache);
+    DisallowCompilation no_compile_expected(i_isolate2);
+    v8::Local<v8::UnboundScript> script =
+        v8::ScriptCompiler::CompileUnboundScript(
+            isolate2, &source_with_cache, v8::ScriptCompiler::kConsumeCodeCache)
+            .ToLocalChecked();
+    CHECK(!cache->rejected);
+    v8::Local<v8::Value> result =
+        script->BindToCurrentContext()->Run(context).ToLocalChecked();
+    CHECK(result->ToString(context)
+              .ToLocalChecked()
+              ->Equals(context, v8_str("abcdef"))
+              .FromJust());
+  }
+  isolate2->Dispose();
+
+  // Restore the flags.
+  FLAG_opt = prev_opt_value;
+  FLAG_always_opt = prev_always_opt_value;
+  FLAG_flush_bytecode = prev_flush_bytecode_value;
+  FLAG_code_cache_recompile_flushed = prev_recompile_flushed_value;
+}
+
 TEST(CodeSerializerFlagChange) {
   const char* source = "function f() { return 'abc'; }; f() + 'def'";
   v8::ScriptCompiler::CachedData* cache = CompileRunAndProduceCache(source);
@@ -0,0 +1,93 @@
+// Copyright 2021 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Every worker waits on its own slot of a shared Int32Array and acknowledges
+// each value stored there on the adjacent slot, which the main thread waits on.
+const kWorkerScript = `
+  onmessage = function({data: {buffer, index}}) {
+    const ia = new Int32Array(buffer);
+    const slot = 2 * index;
+    const ack = slot + 1;
+    let seen = 0;
+    while (true) {
+      Atomics.wait(ia, slot, seen);
+      seen = Atomics.load(ia, slot);
+      if (seen < 0) break;
+      Atomics.store(ia, ack, seen);
+      Atomics.notify(ia, ack);
+    }
+    postMessage('done');
+  };
+`;
+
+const kMaxWorkers = 8;
+const kRounds = 20;
+const kNumSlots = 1024;
+
+let ia = new Int32Array(new SharedArrayBuffer(4 * kNumSlots));
+let workers = [];
+let round = 0;
+
+function StartWorkers(num_workers) {
+  return function() {
+    for (let i = 0; i < num_workers; i++) {
+      const worker = new Worker(kWorkerScript, {type: 'string'});
+      worker.postMessage({buffer: ia.buffer, index: i});
+      workers.push(worker);
+    }
+  };
+}
+
+function StopWorkers() {
+  for (let i = 0; i < workers.length; i++) {
+    Atomics.store(ia, 2 * i, -1);
+    Atomics.notify(ia, 2 * i);
+  }
+  for (const worker of workers) {
+    worker.getMessage();
+    worker.terminate();
+  }
+  workers = [];
+  ia.fill(0);
+  round = 0;
+}
+
+// Notifies all workers and waits until each of them has acknowledged.
+function PingPong() {
+  for (let i = 0; i < kRounds; i++) {
+    round++;
+    for (let w = 0; w < workers.length; w++) {
+      Atomics.store(ia, 2 * w, round);
+      Atomics.notify(ia, 2 * w);
+    }
+    for (let w = 0; w < workers.length; w++) {
+      let acked;
+      while ((acked = Atomics.load(ia, 2 * w + 1)) !== round) {
+        Atomics.wait(ia, 2 * w + 1, acked);
+      }
+    }
+  }
+}
+
+// Notifications of locations nobody waits on.
+function NotifyWithoutWaiters() {
+  for (let i = kMaxWorkers * 2; i < kNumSlots; i++) {
+    Atomics.notify(ia, i);
+  }
+}
+
+function CreateSuite(name, num_workers) {
+  new BenchmarkSuite(name, [1000], [
+    new Benchmark(name, false, false, 0, PingPong, StartWorkers(num_workers),
+                  StopWorkers)
+  ]);
+}
+
+CreateSuite('PingPong-1Worker', 1);
+CreateSuite('PingPong-4Workers', 4);
+CreateSuite('PingPong-8Workers', kMaxWorkers);
+
+new BenchmarkSuite('NotifyWithoutWaiters', [1000], [
+  new Benchmark('NotifyWithoutWaiters', false, false, 0, NotifyWithoutWaiters)
+]);
@@ -0,0 +1,85 @@
+// Copyright 2021 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// JSON.parse on a small corpus of documents: API responses (compact and
+// pretty-printed), numeric data and long strings.
+
+let seed = 42;
+
+function Random(n) {
+  seed = (seed * 1103515245 + 12345) & 0x7fffffff;
+  return (seed >> 8) % n;
+}
+
+function RandomWord(length) {
+  const kAlphabet = "abcdefghijklmnopqrstuvwxyz";
+  let s = "";
+  for (let i = 0; i < length; i++) s += kAlphabet[Random(kAlphabet.length)];
+  return s;
+}
+
+function CreateApiResponse() {
+  const items = [];
+  for (let i = 0; i < 100; i++) {
+    items.push({
+      id: 100000 + i,
+      name: RandomWord(8) + " " + RandomWord(10),
+      email: RandomWord(6) + "@" + RandomWord(7) + ".com",
+      active: Random(2) == 0,
+      score: Random(100000) / 100,
+      tags: [RandomWord(4), RandomWord(5), RandomWord(6)],
+      address: {
+        street: Random(1000) + " " + RandomWord(9) + " St",
+        city: RandomWord(7),
+        zip: String(10000 + Random(90000)),
+      },
+      manager: null,
+    });
+  }
+  return {status: "ok", page: 1, total: items.length, items: items};
+}
+
+function CreateNumericData() {
+  const rows = [];
+  for (let i = 0; i < 200; i++) {
+    rows.push([
+      i,
+      Random(1000000),
+      -Random(1000),
+      Random(10000000) / 1000,
+      (Random(2000000) - 1000000) / 1e6,
+      Random(1000) * 1e-9,
+      Random(1000) * 1e12,
+    ]);
+  }
+  return {columns: ["a", "b", "c", "d", "e", "f", "g"], rows: rows};
+}
+
+function CreateStringData() {
+  const paragraphs = [];
+  for (let i = 0; i < 50; i++) {
+    const words = [];
+    for (let j = 0; j < 80; j++) words.push(RandomWord(1 + Random(10)));
+    // A few escapes, which leave the fast path.
+    paragraphs.push(words.join(" ") + (i % 10 == 0 ? "\n\t\"quoted\"" : ""));
+  }
+  return {title: RandomWord(20), paragraphs: paragraphs};
+}
+
+const kDocuments = {
+  Api: JSON.stringify(CreateApiResponse()),
+  ApiPretty: JSON.stringify(CreateApiResponse(), null, 2),
+  Numeric: JSON.stringify(CreateNumericData()),
+  Strings: JSON.stringify(CreateStringData()),
+};
+
+for (const name in kDocuments) {
+  const document = kDocuments[name];
+  const suite = "JSONParse" + name;
+  new BenchmarkSuite(suite, [5], [
+    new Benchmark(suite, false, false, 0, function() {
+      return JSON.parse(document);
+    }),
+  ]);
+}
@@ -0,0 +1,48 @@
+// Copyright 2021 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// JSON.stringify on arrays of records that share a map.
+
+function CreateRecords(count) {
+  const records = [];
+  for (let i = 0; i < count; i++) {
+    records.push({
+      id: i,
+      name: "record" + i,
+      active: i % 3 == 0,
+      score: i / 8,
+      parent: i > 0 ? i - 1 : null,
+      address: {street: i + " Main St", city: "Springfield", zip: "12345"},
+    });
+  }
+  return records;
+}
+
+const kRecords = CreateRecords(200);
+const kFlatRecords = kRecords.map(r => ({id: r.id, name: r.name,
+                                        active: r.active, score: r.score}));
+
+function StringifyRecords() {
+  return JSON.stringify(kRecords);
+}
+
+function StringifyFlatRecords() {
+  return JSON.stringify(kFlatRecords);
+}
+
+function StringifyRecordsWithGap() {
+  return JSON.stringify(kRecords, null, 2);
+}
+
+new BenchmarkSuite("JSONStringifyRecords", [5], [
+  new Benchmark("JSONStringifyRecords", false, false, 0, StringifyRecords),
+]);
+new BenchmarkSuite("JSONStringifyFlatRecords", [5], [
+  new Benchmark("JSONStringifyFlatRecords", false, false, 0,
+                StringifyFlatRecords),
+]);
+new BenchmarkSuite("JSONStringifyRecordsWithGap", [5], [
+  new Benchmark("JSONStringifyRecordsWithGap", false, false, 0,
+                StringifyRecordsWithGap),
+]);
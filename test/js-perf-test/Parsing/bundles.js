@@ -0,0 +1,95 @@
+// Copyright 2021 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+new BenchmarkSuite("UnminifiedBundle", [1000], [
+  new Benchmark("UnminifiedBundle", false, true, iterations, Run, UnminifiedBundleSetup)
+]);
+
+new BenchmarkSuite("MinifiedBundle", [1000], [
+  new Benchmark("MinifiedBundle", false, true, iterations, Run, MinifiedBundleSetup)
+]);
+
+new BenchmarkSuite("UnminifiedBundleExternal", [1000], [
+  new Benchmark("UnminifiedBundleExternal", false, true, iterations, Run,
+                UnminifiedBundleExternalSetup)
+]);
+
+new BenchmarkSuite("MinifiedBundleExternal", [1000], [
+  new Benchmark("MinifiedBundleExternal", false, true, iterations, Run,
+                MinifiedBundleExternalSetup)
+]);
+
+// A module in the style of a bundler's output, mostly made of identifiers,
+// keywords, indentation and comments.
+const bundleModule = `
+  /**
+   * Keeps track of the registered event listeners of a component.
+   */
+  function createListenerRegistry(componentInstance, registryOptions) {
+    // Listeners are stored by event type.
+    const listenersByEventType = new Map();
+    let dispatchedEventCount = 0;
+
+    function addEventListener(eventType, listenerCallback) {
+      if (!listenersByEventType.has(eventType)) {
+        listenersByEventType.set(eventType, []);
+      }
+      listenersByEventType.get(eventType).push(listenerCallback);
+      return function removeEventListener() {
+        const registeredListeners = listenersByEventType.get(eventType);
+        const listenerIndex = registeredListeners.indexOf(listenerCallback);
+        if (listenerIndex !== -1) registeredListeners.splice(listenerIndex, 1);
+      };
+    }
+
+    function dispatchEvent(eventType, eventPayload) {
+      const registeredListeners = listenersByEventType.get(eventType) || [];
+      for (const listenerCallback of registeredListeners) {
+        listenerCallback.call(componentInstance, eventPayload);
+      }
+      dispatchedEventCount++;
+      return registryOptions.returnCount ? dispatchedEventCount : undefined;
+    }
+
+    return { addEventListener, dispatchEvent };
+  }
+`;
+
+const minifiedBundleModule =
+    'function a(b,c){const d=new Map;let e=0;function f(g,h){' +
+    'if(!d.has(g)){d.set(g,[])}d.get(g).push(h);return function(){' +
+    'const i=d.get(g);const j=i.indexOf(h);if(j!==-1)i.splice(j,1)}}' +
+    'function k(l,m){const n=d.get(l)||[];for(const o of n){o.call(b,m)}' +
+    'e++;return c.returnCount?e:undefined}return{addEventListener:f,' +
+    'dispatchEvent:k}}';
+
+function BundleSource(module) {
+  let source = "";
+  for (let i = 0; i < 100; i++) {
+    source += `var module${i} = (function() {${module}})();\n`;
+  }
+  return source;
+}
+
+function UnminifiedBundleSetup() {
+  code = BundleSource(bundleModule);
+  %FlattenString(code);
+}
+
+function MinifiedBundleSetup() {
+  code = BundleSource(minifiedBundleModule);
+  %FlattenString(code);
+}
+
+// The same sources as external one-byte strings, which the scanner reads
+// directly instead of through its UTF-16 buffer where it can.
+function UnminifiedBundleExternalSetup() {
+  code = BundleSource(bundleModule);
+  externalizeString(code);
+}
+
+function MinifiedBundleExternalSetup() {
+  code = BundleSource(minifiedBundleModule);
+  externalizeString(code);
+}
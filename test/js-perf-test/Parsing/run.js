@@ -11,6 +11,7 @@ let code;
 load("comments.js");
 load("strings.js");
 load("arrowfunctions.js")
+load("bundles.js");
 
 var success = true;
 
@@ -0,0 +1,92 @@
+// Copyright 2021 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+load("base.js");
+
+var str;
+var re;
+
+const templateData = {
+  name: "Widget",
+  price: "4.99",
+  description: "A <small> & \"useful\" widget",
+};
+
+function createTemplate() {
+  let s = "";
+  for (let i = 0; i < 100; i++) {
+    s += "<li class=\"item\">{{name}} ({{price}}): {{description}}</li>\n";
+  }
+  return s;
+}
+
+function createRenderedTemplate() {
+  return createTemplate().replace(/\{\{(\w+)\}\}/g,
+                                  (match, key) => templateData[key]);
+}
+
+const htmlEscapes = {
+  "&": "&amp;",
+  "<": "&lt;",
+  ">": "&gt;",
+  "\"": "&quot;",
+};
+
+function RenderTemplate() {
+  str.replace(re, (match, key) => templateData[key]);
+}
+
+function RenderTemplateWithoutCaptures() {
+  str.replace(re, (match) => templateData[match.slice(2, -2)]);
+}
+
+function SubstituteConstant() {
+  str.replace(re, "Widget");
+}
+
+function SubstituteWithPattern() {
+  str.replace(re, "[$1]");
+}
+
+function EscapeHtml() {
+  str.replace(re, (c) => htmlEscapes[c]);
+}
+
+function SplitTemplate() {
+  str.split(re);
+}
+
+function PlaceholderSetup() {
+  re = /\{\{(\w+)\}\}/g;
+  str = createTemplate();
+}
+
+function PlaceholderWithoutCapturesSetup() {
+  re = /\{\{\w+\}\}/g;
+  str = createTemplate();
+}
+
+function NamePlaceholderSetup() {
+  re = /\{\{name\}\}/g;
+  str = createTemplate();
+}
+
+function EscapeHtmlSetup() {
+  re = /[&<>"]/g;
+  str = createRenderedTemplate();
+}
+
+function SplitPlaceholderSetup() {
+  re = /\{\{\w+\}\}/;
+  str = createTemplate();
+}
+
+var benchmarks = [ [ RenderTemplate, PlaceholderSetup ],
+                   [ RenderTemplateWithoutCaptures,
+                     PlaceholderWithoutCapturesSetup ],
+                   [ SubstituteConstant, NamePlaceholderSetup ],
+                   [ SubstituteWithPattern, PlaceholderSetup ],
+                   [ EscapeHtml, EscapeHtmlSetup ],
+                   [ SplitTemplate, SplitPlaceholderSetup ],
+                 ];
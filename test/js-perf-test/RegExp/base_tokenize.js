@@ -0,0 +1,68 @@
+// Copyright 2021 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+load("base.js");
+
+var str;
+var re;
+
+function createDna() {
+  // Deterministic pseudo-random nucleotides, with a few regexp-dna variants
+  // sprinkled in.
+  const nucleotides = "acgt";
+  let seed = 42;
+  let s = "";
+  for (let i = 0; i < 10000; i++) {
+    seed = (seed * 1103515245 + 12345) & 0x7fffffff;
+    s += nucleotides[seed & 3];
+    if (i % 997 == 0) s += "agggtaaa";
+    if (i % 1499 == 0) s += "tttaccct";
+  }
+  return s;
+}
+
+function createSource() {
+  let s = "";
+  for (let i = 0; i < 50; i++) {
+    s += "function f" + i + "(a, b) {\n" +
+         "  if (a < b) { return a + " + i + "; } else { return b * 2; }\n" +
+         "}\n";
+  }
+  return s;
+}
+
+function CountVariants() {
+  str.match(re);
+}
+
+function Tokenize() {
+  re.lastIndex = 0;
+  while (re.lastIndex < str.length && re.test(str)) {}
+}
+
+function DnaVariantSetup() {
+  re = /agggtaaa|tttaccct/ig;
+  str = createDna();
+}
+
+function DnaClassVariantSetup() {
+  re = /[cgt]gggtaaa|tttaccc[acg]/ig;
+  str = createDna();
+}
+
+function KeywordTokenSetup() {
+  re = /function|return|else|if|\(|\)|\{|\}|;|,|\n| |./y;
+  str = createSource();
+}
+
+function IdentifierTokenSetup() {
+  re = /\s+|[A-Za-z_$][\w$]*|\d+|[-+*\/<>=(){};,]/y;
+  str = createSource();
+}
+
+var benchmarks = [ [ CountVariants, DnaVariantSetup ],
+                   [ CountVariants, DnaClassVariantSetup ],
+                   [ Tokenize, KeywordTokenSetup ],
+                   [ Tokenize, IdentifierTokenSetup ],
+                 ];
@@ -15,7 +15,9 @@ load('match.js');
 load('replace.js');
 load('search.js');
 load('split.js');
+load('template.js');
 load('test.js');
+load('tokenize.js');
 load('slow_exec.js');
 load('slow_flags.js');
 load('slow_match.js');
@@ -0,0 +1,66 @@
+// Copyright 2021 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Exercises the per-character string kernels (case conversion, equality and
+// hashing) on several string lengths.
+
+const kLengths = [8, 64, 1024];
+const kAlphabet = "aBcDeFgHiJkLmNoPqRsTuVwXyZ-_ 0123";
+
+function CreateString(length) {
+  // The same characters on every run.
+  BenchmarkSuite.ResetRNG();
+  let s = "";
+  for (let i = 0; i < length; i++) {
+    s += kAlphabet[Math.floor(Math.random() * kAlphabet.length)];
+  }
+  return s;
+}
+
+function CreateToLowerCaseBenchmark(length) {
+  // Slices start at odd offsets into their parent's characters.
+  const parent = "#" + CreateString(length);
+  const subject = parent.substring(1);
+  return function() {
+    return subject.toLowerCase().length + subject.toUpperCase().length;
+  };
+}
+
+function CreateEqualsBenchmark(length) {
+  const one_byte = CreateString(length);
+  // Same characters, but in a two-byte representation.
+  const two_byte = ("☃" + one_byte).substring(1);
+  const different = one_byte.substring(0, length - 1) + "!";
+  return function() {
+    let result = 0;
+    if (one_byte == two_byte) result++;
+    if (two_byte == different) result++;
+    return result;
+  };
+}
+
+function CreateHashBenchmark(length) {
+  const prefix = CreateString(length);
+  return function() {
+    // Fresh keys, whose hashes have not been computed yet.
+    const map = new Map();
+    for (let i = 0; i < 10; i++) map.set(prefix + i, i);
+    return map.size;
+  };
+}
+
+const kBenchmarks = {
+  ToLowerCase: CreateToLowerCaseBenchmark,
+  Equals: CreateEqualsBenchmark,
+  Hash: CreateHashBenchmark,
+};
+
+for (const name in kBenchmarks) {
+  for (const length of kLengths) {
+    const suite = "StringKernels" + name + "Length" + length;
+    new BenchmarkSuite(suite, [5], [
+      new Benchmark(suite, false, false, 0, kBenchmarks[name](length)),
+    ]);
+  }
+}
@@ -0,0 +1,54 @@
+// Copyright 2021 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Searches for patterns of several lengths in subjects over alphabets of
+// several sizes. Small alphabets make the first character of the pattern
+// common in the subject.
+
+const kAlphabets = {
+  Alphabet2: "ab",
+  Alphabet4: "acgt",
+  Alphabet26: "abcdefghijklmnopqrstuvwxyz",
+};
+const kPatternLengths = [2, 6, 16];
+
+function CreateSubject(alphabet, length) {
+  // The same characters on every run.
+  BenchmarkSuite.ResetRNG();
+  let s = "";
+  for (let i = 0; i < length; i++) {
+    s += alphabet[Math.floor(Math.random() * alphabet.length)];
+  }
+  return s;
+}
+
+function CreateBenchmark(alphabet, pattern_length, two_byte) {
+  let subject = CreateSubject(alphabet, 10000);
+  if (two_byte) subject = "☃" + subject;
+  // Patterns that occur once, near the end of the subject, and not at all.
+  const present = subject.substring(subject.length - 100,
+                                    subject.length - 100 + pattern_length);
+  const absent = present.substring(0, pattern_length - 1) + "#";
+  return function() {
+    let result = subject.indexOf(present) + subject.indexOf(absent);
+    if (subject.includes(absent)) result++;
+    result += subject.split(absent).length;
+    result += subject.replace(absent, "").length;
+    return result;
+  };
+}
+
+for (const name in kAlphabets) {
+  for (const pattern_length of kPatternLengths) {
+    for (const two_byte of [false, true]) {
+      const suite = "StringSearch" + (two_byte ? "TwoByte" : "") + name +
+                    "Length" + pattern_length;
+      new BenchmarkSuite(suite, [5], [
+        new Benchmark(suite, false, false, 0,
+                      CreateBenchmark(kAlphabets[name], pattern_length,
+                                      two_byte)),
+      ]);
+    }
+  }
+}
@@ -0,0 +1,61 @@
+// Copyright 2021 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// A module with four functions f1..f4 of signature i_i, where fk adds k to
+// its argument, a table of size 4 filled with {targets}, and exporting
+//   run(count, mask): calls table[i & mask](sum) through call_indirect for
+//                     i = 0 .. count - 1, starting with sum = 0, and returns
+//                     the final sum.
+function CreateModuleBytes(targets) {
+  return new Uint8Array([
+    0x00, 0x61, 0x73, 0x6d, 0x01, 0x00, 0x00, 0x00,  // header
+    0x01, 0x0c, 0x02, 0x60, 0x01, 0x7f, 0x01, 0x7f,  // type section
+    0x60, 0x02, 0x7f, 0x7f, 0x01, 0x7f,
+    0x03, 0x06, 0x05, 0x00, 0x00, 0x00, 0x00, 0x01,  // function section
+    0x04, 0x05, 0x01, 0x70, 0x01, 0x04, 0x04,        // table section
+    0x07, 0x07, 0x01, 0x03, 0x72, 0x75, 0x6e, 0x00,  // export section
+    0x04,
+    0x09, 0x0a, 0x01, 0x00, 0x41, 0x00, 0x0b, 0x04,  // element section
+    ...targets,
+    0x0a, 0x4f, 0x05,                                // code section
+    0x07, 0x00, 0x20, 0x00, 0x41, 0x01, 0x6a, 0x0b,  // f1
+    0x07, 0x00, 0x20, 0x00, 0x41, 0x02, 0x6a, 0x0b,  // f2
+    0x07, 0x00, 0x20, 0x00, 0x41, 0x03, 0x6a, 0x0b,  // f3
+    0x07, 0x00, 0x20, 0x00, 0x41, 0x04, 0x6a, 0x0b,  // f4
+    0x2d, 0x01, 0x02, 0x7f,                          // run
+    0x02, 0x40,                                      // block
+    0x03, 0x40,                                      // loop
+    0x20, 0x00, 0x45, 0x0d, 0x01,                    // br_if count == 0
+    0x20, 0x02, 0x20, 0x03, 0x20, 0x01, 0x71,        // sum = table[i & mask]
+    0x11, 0x00, 0x00, 0x21, 0x02,                    //         (sum)
+    0x20, 0x03, 0x41, 0x01, 0x6a, 0x21, 0x03,        // i++
+    0x20, 0x00, 0x41, 0x01, 0x6b, 0x21, 0x00,        // count--
+    0x0c, 0x00, 0x0b, 0x0b,                          // br loop
+    0x20, 0x02, 0x0b                                 // return sum
+  ]);
+}
+
+const kCount = 1 << 20;
+
+function CreateBenchmark(name, targets) {
+  const instance = new WebAssembly.Instance(
+      new WebAssembly.Module(CreateModuleBytes(targets)));
+  // Each of the four table entries is called kCount / 4 times.
+  const expected = targets.reduce((sum, target) => sum + target + 1, 0) *
+                   (kCount / 4);
+  function Run() {
+    if (instance.exports.run(kCount, 3) !== expected) {
+      throw new Error(`${name}: unexpected result`);
+    }
+  }
+  new BenchmarkSuite(name, [1000], [
+    new Benchmark(name, false, false, 0, Run)
+  ]);
+}
+
+// Only f1 is placed into the table, so every call site of its signature has
+// a single possible target.
+CreateBenchmark('Monomorphic', [0, 0, 0, 0]);
+// The call site cycles through four different targets.
+CreateBenchmark('Polymorphic', [0, 1, 2, 3]);
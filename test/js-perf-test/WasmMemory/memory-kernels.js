@@ -0,0 +1,52 @@
+// Copyright 2021 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// A module with a 256MiB memory, exporting
+//   sum(stride, count): sums up {count} i32 values, starting at offset 0 and
+//                       advancing by {stride} bytes (modulo the memory size).
+const kModuleBytes = new Uint8Array([
+  0x00, 0x61, 0x73, 0x6d, 0x01, 0x00, 0x00, 0x00,  // header
+  0x01, 0x07, 0x01, 0x60, 0x02, 0x7f, 0x7f, 0x01,  // type section
+  0x7f,
+  0x03, 0x02, 0x01, 0x00,                          // function section
+  0x05, 0x04, 0x01, 0x00, 0x80, 0x20,              // memory section
+  0x07, 0x0d, 0x02, 0x03, 0x73, 0x75, 0x6d, 0x00,  // export section
+  0x00, 0x03, 0x6d, 0x65, 0x6d, 0x02, 0x00,
+  0x0a, 0x34, 0x01, 0x32, 0x01, 0x02, 0x7f,        // code section
+  0x02, 0x40,                                      // block
+  0x03, 0x40,                                      // loop
+  0x20, 0x01, 0x45, 0x0d, 0x01,                    // br_if count == 0
+  0x20, 0x02, 0x20, 0x03, 0x28, 0x02, 0x00,        // sum += load(addr)
+  0x6a, 0x21, 0x02,
+  0x20, 0x03, 0x20, 0x00, 0x6a,                    // addr = (addr + stride)
+  0x41, 0xfc, 0xff, 0xff, 0xff, 0x00, 0x71,        //        & mask
+  0x21, 0x03,
+  0x20, 0x01, 0x41, 0x01, 0x6b, 0x21, 0x01,        // count--
+  0x0c, 0x00, 0x0b, 0x0b,                          // br loop
+  0x20, 0x02, 0x0b                                 // return sum
+]);
+
+const kMemorySize = 256 * 1024 * 1024;
+
+const instance =
+    new WebAssembly.Instance(new WebAssembly.Module(kModuleBytes));
+// Commit all pages up front, so that page faults are not measured.
+new Int32Array(instance.exports.mem.buffer).fill(1);
+
+function CreateBenchmark(name, stride, count) {
+  function Run() {
+    if (instance.exports.sum(stride, count) !== count) {
+      throw new Error(`${name}: unexpected result`);
+    }
+  }
+  new BenchmarkSuite(name, [1000], [
+    new Benchmark(name, false, false, 0, Run)
+  ]);
+}
+
+CreateBenchmark('Sequential', 4, 1 << 20);
+// One access per 4KiB page, covering the whole memory.
+CreateBenchmark('Strided-4K', 4096 + 4, kMemorySize >> 12);
+// One access per 2MiB huge page, sweeping the memory repeatedly.
+CreateBenchmark('Strided-2M', 2 * 1024 * 1024 + 4, 1 << 16);
@@ -0,0 +1,74 @@
+// Copyright 2021 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+const parse = d8.json.parseInBackground;
+
+function AssertParsesLikeJSONParse(string) {
+  const expected = JSON.parse(string);
+  const actual = parse(string);
+  assertEquals(expected, actual);
+  assertEquals(JSON.stringify(expected), JSON.stringify(actual));
+  return actual;
+}
+
+(function TestPrimitives() {
+  for (const string of ["0", "-0", "1", "-1", "1.5", "-1e-7", "1E+300",
+                        "123456789", "1234567890", "-2147483649", "true",
+                        "false", "null", '""', '"foo"', ' \t\r\n"x" ']) {
+    AssertParsesLikeJSONParse(string);
+  }
+  assertTrue(Object.is(-0, parse("-0")));
+})();
+
+(function TestStrings() {
+  for (const string of ['"short"', '"a string longer than ten characters"',
+                        '"\\u00e9\\u2603\\n\\t\\"\\\\\\/\\b\\f\\r"',
+                        '"☃ in a two-byte string"', '"\\ud83d\\ude00"']) {
+    AssertParsesLikeJSONParse(string);
+  }
+})();
+
+(function TestObjectsAndArrays() {
+  AssertParsesLikeJSONParse('{}');
+  AssertParsesLikeJSONParse('[]');
+  AssertParsesLikeJSONParse('[1, 2, 3]');
+  AssertParsesLikeJSONParse('[1, 2.5, 3]');
+  AssertParsesLikeJSONParse('[1, "two", null, [], {}]');
+  AssertParsesLikeJSONParse('{"a": 1, "b": [true, false], "c": {"d": "e"}}');
+  // Duplicate keys, array index keys and __proto__.
+  const object = AssertParsesLikeJSONParse(
+      '{"a": 1, "a": 2, "1": "x", "0": "y", "__proto__": []}');
+  assertEquals(["0", "1", "a", "__proto__"], Object.keys(object));
+  assertSame(Object.prototype, Object.getPrototypeOf(object));
+
+  const records = [];
+  for (let i = 0; i < 1000; i++) {
+    records.push({id: i, name: "name" + i, score: i / 7, tags: ["x", i]});
+  }
+  AssertParsesLikeJSONParse(JSON.stringify(records));
+  AssertParsesLikeJSONParse("[".repeat(100) + "]".repeat(100));
+
+  // Nesting is not limited by the native stack.
+  let array = parse("[".repeat(100000) + "]".repeat(100000));
+  for (let i = 1; i < 100000; i++) {
+    assertEquals(1, array.length);
+    array = array[0];
+  }
+  assertEquals([], array);
+})();
+
+(function TestSyntaxErrors() {
+  for (const string of ["", "{", "[1,]", '{"a" 1}', '"\\x"', '"\u0001"',
+                        "01", "-", "1.", "1e", "tru", "nul", "[1] 2",
+                        '{"a": 1,}', '"unterminated']) {
+    let expected;
+    try {
+      JSON.parse(string);
+    } catch (e) {
+      expected = e;
+    }
+    assertInstanceof(expected, SyntaxError);
+    assertThrows(() => parse(string), SyntaxError, expected.message);
+  }
+})();
@@ -0,0 +1,54 @@
+// Copyright 2021 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// String bodies and whitespace are scanned a word at a time, and short
+// decimal numbers are converted without StringToDouble.
+
+(function TestStringTerminatorsAtEveryOffset() {
+  const kTerminators = ['"', '\\', '\n', '\x00', '\x1f'];
+  for (let length = 0; length < 40; length++) {
+    const prefix = "x".repeat(length);
+    assertEquals(prefix, JSON.parse('"' + prefix + '"'));
+    assertEquals(prefix + "éÿ", JSON.parse('"' + prefix + 'éÿ"'));
+    for (const terminator of kTerminators) {
+      const escaped = JSON.stringify(prefix + terminator + prefix);
+      assertEquals(prefix + terminator + prefix, JSON.parse(escaped));
+      if (terminator != '"' && terminator != '\\') {
+        assertThrows(() => JSON.parse('"' + prefix + terminator + '"'),
+                     SyntaxError);
+      }
+    }
+  }
+})();
+
+(function TestWhitespaceRuns() {
+  const kWhitespace = [" ", "\t", "\n", "\r"];
+  for (let length = 0; length < 40; length++) {
+    let space = "";
+    for (let i = 0; i < length; i++) space += kWhitespace[i % 4];
+    assertEquals({a: [1, "b"]},
+                 JSON.parse(space + '{' + space + '"a"' + space + ':' + space +
+                            '[1' + space + ',"b"]' + space + '}' + space));
+    assertThrows(() => JSON.parse(space + "\v1"), SyntaxError);
+    assertThrows(() => JSON.parse(space + " 1"), SyntaxError);
+  }
+})();
+
+(function TestNumbers() {
+  const kNumbers = [
+    "0", "-0", "0.0", "-0.0", "0e5", "-0e-5", "1", "-1", "0.1", "0.3",
+    "1.5", "-2.25", "123.456", "0.000001", "1e22", "1e23", "1e-22", "1e-23",
+    "9007199254740991", "9007199254740993", "123456789012345",
+    "1234567890123456", "0.1234567890123456789", "1.7976931348623157e308",
+    "5e-324", "1e309", "-1e309", "1e-400", "2.2250738585072014e-308",
+    "123456789012345e-22", "1E+10", "1e+022", "4.35", "100000000000000000",
+    "0.00000000000000000000000000001234",
+  ];
+  for (const number of kNumbers) {
+    assertEquals(Number(number), JSON.parse(number), number);
+    assertEquals([Number(number)], JSON.parse("[" + number + "]"), number);
+  }
+  assertEquals(-Infinity, 1 / JSON.parse("-0.0"));
+  assertEquals(-Infinity, 1 / JSON.parse("-0e-5"));
+})();
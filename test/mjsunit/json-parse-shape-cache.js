@@ -0,0 +1,62 @@
+// Copyright 2021 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax
+
+// JSON.parse predicts the map of an object from earlier objects with the same
+// keys, which need not be its siblings.
+
+(function TestNestedRecords() {
+  const records = JSON.parse(
+      '[{"id":1,"user":{"name":"a","age":1}},' +
+      '{"id":2,"user":{"name":"b","age":2}},' +
+      '{"id":3,"user":{"name":"c","age":3}}]');
+  assertEquals({id: 3, user: {name: "c", age: 3}}, records[2]);
+  assertTrue(%HaveSameMap(records[0].user, records[1].user));
+  assertTrue(%HaveSameMap(records[1].user, records[2].user));
+  assertTrue(%HasFastProperties(records[2].user));
+})();
+
+(function TestAlternatingRecords() {
+  const items = JSON.parse(
+      '[{"x":1,"y":2},{"kind":"z"},{"x":3,"y":4},{"kind":"w"},{"x":5,"y":6}]');
+  assertEquals([{x: 1, y: 2}, {kind: "z"}, {x: 3, y: 4}, {kind: "w"},
+                {x: 5, y: 6}], items);
+  assertTrue(%HaveSameMap(items[0], items[4]));
+  assertTrue(%HaveSameMap(items[1], items[3]));
+})();
+
+(function TestKeyMismatch() {
+  // Keys with the same length and first and last characters.
+  const objects = JSON.parse(
+      '{"a":{"axb":1,"cd":2},"b":{"ayb":3,"cd":4},"c":{"axb":5,"ce":6},' +
+      '"d":{"a\\u0078b":7,"cd":8}}');
+  assertEquals({axb: 1, cd: 2}, objects.a);
+  assertEquals({ayb: 3, cd: 4}, objects.b);
+  assertEquals({axb: 5, ce: 6}, objects.c);
+  assertEquals({axb: 7, cd: 8}, objects.d);
+  assertEquals(["ayb", "cd"], Object.keys(objects.b));
+  assertTrue(%HaveSameMap(objects.a, objects.d));
+  assertFalse(%HaveSameMap(objects.a, objects.b));
+})();
+
+(function TestElements() {
+  const objects = JSON.parse(
+      '[[{"a":1,"0":2}],[{"a":3}],[{"a":4,"100000":5}],[{"a":6,"1":7}]]');
+  assertEquals({a: 1, 0: 2}, objects[0][0]);
+  assertEquals({a: 3}, objects[1][0]);
+  assertEquals({a: 4, 100000: 5}, objects[2][0]);
+  assertEquals({a: 6, 1: 7}, objects[3][0]);
+})();
+
+(function TestFieldRepresentations() {
+  // Objects taking their map from the cache may generalize its fields.
+  const objects = JSON.parse(
+      '{"a":{"p":1,"q":1},"b":{"p":"s","q":2},"c":{"p":2.5,"q":{}}}');
+  assertEquals({p: 1, q: 1}, objects.a);
+  assertEquals({p: "s", q: 2}, objects.b);
+  assertEquals({p: 2.5, q: {}}, objects.c);
+  assertTrue(%HasFastProperties(objects.b));
+  assertTrue(%HasFastProperties(objects.c));
+})();
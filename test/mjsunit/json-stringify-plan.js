@@ -0,0 +1,91 @@
+// Copyright 2021 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Objects with a map that JSON.stringify has seen before are serialized along
+// a plan with pre-escaped keys.
+
+function Records(count, make) {
+  const records = [];
+  for (let i = 0; i < count; i++) records.push(make(i));
+  return records;
+}
+
+(function TestPrimitives() {
+  const records = Records(3, i => ({
+    i: i, d: i + 0.5, s: "s" + i, t: true, f: false, n: null,
+    u: undefined, sym: Symbol(), fn: () => 1,
+  }));
+  const expected = '{"i":0,"d":0.5,"s":"s0","t":true,"f":false,"n":null}';
+  assertEquals(expected, JSON.stringify(records[0]));
+  assertEquals("[" + records.map(r => JSON.stringify(r)).join(",") + "]",
+               JSON.stringify(records));
+  assertEquals('[{"u":1},{}]', JSON.stringify([{u: 1}, {u: undefined}]));
+  assertEquals('[{"u":{}},{"u":1}]',
+               JSON.stringify([{u: {toJSON() { return {}; }}}, {u: 1}]));
+})();
+
+(function TestKeys() {
+  const records = Records(3, i => ({
+    "a\"b": i, "\\": i, "\n": i, "é": i, "☃": i, " !#": i,
+  }));
+  assertEquals('{"a\\"b":2,"\\\\":2,"\\n":2,"é":2,"☃":2," !#":2}',
+               JSON.stringify(records[2]));
+  const result = JSON.parse(JSON.stringify(records));
+  assertEquals(records, result);
+})();
+
+(function TestGap() {
+  assertEquals('[\n  {\n    "a": 1,\n    "b": "x"\n  },\n  {\n    "a": 2,\n' +
+               '    "b": "y"\n  }\n]',
+               JSON.stringify([{a: 1, b: "x"}, {a: 2, b: "y"}], null, 2));
+})();
+
+(function TestReplacer() {
+  const records = Records(3, i => ({a: i, b: i}));
+  assertEquals('[{"a":0,"b":"0"},{"a":1,"b":"1"},{"a":2,"b":"2"}]',
+               JSON.stringify(records,
+                              (key, value) => key == "b" ? String(value) :
+                                                           value));
+  assertEquals('[{"b":0},{"b":1},{"b":2}]', JSON.stringify(records, ["b"]));
+})();
+
+(function TestNotEnumerableAndAccessors() {
+  const records = Records(3, i => {
+    const record = {a: i};
+    Object.defineProperty(record, "hidden", {value: i, enumerable: false});
+    record[Symbol()] = i;
+    return record;
+  });
+  assertEquals('[{"a":0},{"a":1},{"a":2}]', JSON.stringify(records));
+  const getters = Records(3, i => ({a: i, get b() { return i * 2; }}));
+  assertEquals('[{"a":0,"b":0},{"a":1,"b":2},{"a":2,"b":4}]',
+               JSON.stringify(getters));
+})();
+
+(function TestMapChangesDuringSerialization() {
+  // toJSON changes later records: the field representation of "a" is
+  // generalized, then "b" is deleted, changing the map of the last record.
+  const records = Records(4, i => ({a: i, b: i, c: 0.5}));
+  records[0].c = {
+    toJSON() {
+      records[2].a = "x";
+      delete records[3].b;
+      return 1;
+    }
+  };
+  assertEquals('[{"a":0,"b":0,"c":1},{"a":1,"b":1,"c":0.5},' +
+               '{"a":"x","b":2,"c":0.5},{"a":3,"c":0.5}]',
+               JSON.stringify(records));
+})();
+
+(function TestManyMaps() {
+  const records = [];
+  for (let i = 0; i < 50; i++) {
+    const record = {};
+    record["k" + (i % 20)] = i;
+    record.v = "v";
+    records.push(record);
+  }
+  assertEquals(records, JSON.parse(JSON.stringify(records)));
+})();
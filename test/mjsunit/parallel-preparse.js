@@ -0,0 +1,69 @@
+// Copyright 2021 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --parallel-preparse --parallel-preparse-min-size=0
+
+// Top-level functions of large scripts are preparsed on worker threads. The
+// lazily compiled functions must behave as if the main thread had preparsed
+// them.
+
+function makeScript(prologue, count) {
+  let source = prologue;
+  for (let i = 0; i < count; i++) {
+    source += `
+      function f${i}(a, b = ${i}) {
+        var local = "${'x'.repeat(100)}";
+        function inner(c) { return a + b + c + local.length; }
+        return inner(1);
+      }
+      var g${i} = function(x) {
+        "use strict";
+        return (function() { return this; })() === undefined ? x : -x;
+      };
+      function* gen${i}() { yield ${i}; }
+      async function async${i}() { return ${i}; }
+      var ev${i} = function(code) { var hidden = ${i}; return eval(code); };
+      // function commented${i}() {
+      var str${i} = "function inString${i}() {";
+      var re${i} = /function inRegExp${i}\\(\\) {/;
+      var tpl${i} = \`\${ function inTemplate() { return ${i}; }() }{\`;
+    `;
+  }
+  source += `
+    var results = [];
+    for (var i = 0; i < ${count}; i++) {
+      results.push([
+        this['f' + i](1), f${count - 1}.length, this['g' + i](2),
+        this['gen' + i]().next().value, this['ev' + i]('hidden'),
+        this['tpl' + i]
+      ]);
+    }
+    results;
+  `;
+  return source;
+}
+
+(function TestSloppyScript() {
+  const count = 400;
+  const results = Realm.eval(Realm.current(), makeScript('', count));
+  assertEquals(count, results.length);
+  for (let i = 0; i < count; i++) {
+    assertEquals([i + 1 + 1 + 100, 1, 2, i, i, i + '{'], results[i]);
+  }
+})();
+
+(function TestStrictScript() {
+  const count = 400;
+  const results =
+      Realm.eval(Realm.current(), makeScript('"use strict";', count));
+  assertEquals(count, results.length);
+  for (let i = 0; i < count; i++) {
+    assertEquals([i + 1 + 1 + 100, 1, 2, i, i, i + '{'], results[i]);
+  }
+})();
+
+(function TestEarlyErrors() {
+  const source = makeScript('', 100) + 'function bad(a, a) { "use strict"; }';
+  assertThrows(() => Realm.eval(Realm.current(), source), SyntaxError);
+})();
@@ -0,0 +1,38 @@
+// Copyright 2021 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --regexp-elide-stack-checks --no-regexp-tier-up
+// Flags: --no-regexp-interpret-all
+
+// Regexps without loops reserve backtrack stack space for all of their pushes
+// when a match attempt starts.
+
+(function TestAlternatives() {
+  const re = /agggtaaa|tttaccct/ig;
+  const dna = "ac".repeat(100) + "AGGGTAAA" + "gt".repeat(100) + "tttaccct";
+  assertEquals(["AGGGTAAA", "tttaccct"], dna.match(re));
+})();
+
+(function TestCapturesAndLookarounds() {
+  assertEquals(["ab", "a", "b"], /(a)(?=b)(b)?/.exec("xab"));
+  assertEquals(["b"], /(?<=a)b|c/.exec("cab").slice(0, 1));
+  assertEquals(["c", undefined], /(?:(a)b)?c/.exec("xc"));
+})();
+
+(function TestManyAlternatives() {
+  // Enough pushes to outgrow the initial backtrack stack.
+  const words = [];
+  for (let i = 0; i < 5000; i++) words.push("w" + i + "x");
+  const re = new RegExp(words.join("|"));
+  assertEquals(["w4999x"], re.exec("w4999x"));
+  assertEquals(["w17x"], re.exec("..w17x.."));
+  assertNull(re.exec("w5000x"));
+  const global = new RegExp(words.join("|"), "g");
+  assertEquals(["w1x", "w2x", "w3x"], "w1x w2x w3x".match(global));
+})();
+
+(function TestRegExpsWithLoops() {
+  assertEquals(["aaab"], /a+b|c/.exec("aaab"));
+  assertEquals(["aaa", "a"], /(a){2,}/.exec("aaa"));
+})();
@@ -0,0 +1,80 @@
+// Copyright 2021 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --regexp-tier-up --regexp-tier-up-ticks=10
+// Flags: --regexp-native-code-budget=1 --no-regexp-interpret-all
+// Flags: --no-enable-experimental-regexp-engine
+// Flags: --no-enable-experimental-regexp-engine-on-excessive-backtracks
+
+const kLatin1 = true;
+
+// Regexp data is cached per isolate by source, and the stress variant runs
+// this test several times in one isolate. A group repeated zero times makes
+// the regexps of every run distinct without generating any code for them.
+const kUniqueSuffix = `(?:${Math.random().toString().slice(2)}){0}`;
+
+function NewRegExp(source) {
+  return new RegExp(source + kUniqueSuffix);
+}
+
+function HasBytecode(re) {
+  return %RegexpHasBytecode(re, kLatin1);
+}
+
+function HasNativeCode(re) {
+  return !%RegexpHasBytecode(re, kLatin1) && %RegexpHasNativeCode(re, kLatin1);
+}
+
+(function TestShortSubjectsCostOneTick() {
+  const re = NewRegExp("[ab]+c");
+  for (let i = 0; i < 10; i++) {
+    assertTrue(re.test("abc"));
+    assertTrue(HasBytecode(re));
+  }
+  assertTrue(re.test("abc"));
+  assertTrue(HasNativeCode(re));
+})();
+
+(function TestLongerSubjectsCostMoreTicks() {
+  // Six ticks per execution: one, plus one for every 100 characters.
+  const subject = "z".repeat(500) + "de";
+  const re = NewRegExp("[de]+f|e");
+  assertTrue(re.test(subject));
+  assertTrue(HasBytecode(re));
+  assertTrue(re.test(subject));
+  assertTrue(HasBytecode(re));
+  assertTrue(re.test(subject));
+  assertTrue(HasNativeCode(re));
+})();
+
+(function TestBacktracksCostMoreTicks() {
+  const re = NewRegExp("(g+)+h");
+  assertFalse(re.test("g".repeat(14)));
+  assertTrue(HasBytecode(re));
+  assertFalse(re.test("g".repeat(14)));
+  assertTrue(HasNativeCode(re));
+})();
+
+(function TestColdNativeCodeIsDropped() {
+  // Subjects this long tier up before the first execution.
+  const subject = "z".repeat(1000);
+  const regexps = [];
+  for (let i = 0; i < 20; i++) {
+    const re = NewRegExp("[xy]" + i + "|q" + i);
+    assertFalse(re.test(subject));
+    assertTrue(HasNativeCode(re));
+    regexps.push(re);
+  }
+  // The budget only holds a few regexps; the oldest ones are back to being
+  // uncompiled, and tier up again from the interpreter.
+  const re = regexps[0];
+  assertFalse(%RegexpHasBytecode(re, kLatin1));
+  assertFalse(%RegexpHasNativeCode(re, kLatin1));
+  assertTrue(re.test("x0"));
+  assertTrue(HasBytecode(re));
+  assertEquals(["y0"], re.exec("zzy0"));
+  for (let i = 0; i < 20; i++) {
+    assertTrue(regexps[i].test("q" + i));
+  }
+})();
@@ -96,3 +96,13 @@ Test(/x$/m, "x\na", ["x"], 0);
 
 // The dotall flag.
 Test(/asdf.xyz/s,  "asdf\nxyz", ["asdf\nxyz"], 0);
+
+// Unanchored searches, including ones in long subjects.
+Test(/xyz/, "a".repeat(1000) + "xyz", ["xyz"], 0);
+Test(/xyz/, "a".repeat(1000), null, 0);
+Test(/[x-z]+a/, "..x..yya..", ["yya"], 0);
+Test(/\bfoo/, "afoo foo", ["foo"], 0);
+Test(/(?:a|b)*c/, "...ac", ["ac"], 0);
+Test(/a|쁰/, "...쁰a", ["쁰"], 0);
+Test(/x*/, "...x", [""], 0);
+Test(/ab/g, "xxxxabxxab", ["ab"], 6);
@@ -0,0 +1,37 @@
+// Copyright 2021 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --regexp-interpret-all --regexp-peephole-optimization
+
+// Greedy loops over a single character or a character range are fused into
+// single bytecodes by the peephole optimizer.
+
+(function TestNotChar() {
+  assertEquals(["aaa"], /a+/.exec("baaab"));
+  assertEquals(["aaa", "aa"], /(a*)a/.exec("aaa"));
+  assertEquals(["aaab"], /a*b/.exec("aaab"));
+  assertEquals(null, /a+b/.exec("aaac"));
+  assertEquals(["☃☃x"], /☃*x/.exec("☃☃x"));
+})();
+
+(function TestCharNotInRange() {
+  assertEquals(["hello"], /[a-z]+/.exec("  hello World"));
+  assertEquals(["123", "12"], /([0-9]*)[0-9]/.exec("x123"));
+  assertEquals(["abc"], /[a-z]*/.exec("abc"));
+  assertEquals([""], /[a-z]*/.exec("ABC"));
+  assertEquals(["αβ"], /[α-ω]+/.exec("xαβy"));
+})();
+
+(function TestCharInRange() {
+  assertEquals(["--", "-"], /([^0-9]*)[^0-9]/.exec("--1"));
+  assertEquals(["abc"], /[^A-Z]+/.exec("abcDEF"));
+  assertEquals(["abc"], /[^A-Z]*/.exec("abc"));
+  assertEquals(["x"], /[^α-ω]+/.exec("xα"));
+})();
+
+(function TestGlobal() {
+  assertEquals(["foo", "bar", "baz"], "foo, bar,baz".match(/[a-z]+/g));
+  assertEquals(["aa", "a"], "aabaca".match(/a+(?=[bc])/g));
+  assertEquals("X X", "hello world".replace(/[^ ]+/g, "X"));
+})();
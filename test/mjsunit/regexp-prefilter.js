@@ -0,0 +1,66 @@
+// Copyright 2021 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --regexp-prefilter
+
+// Subjects are long enough to take the prefilter path in the runtime.
+const padding = "x".repeat(2000);
+const twoBytePadding = "☃".repeat(2000);
+
+(function TestLiteralPrefix() {
+  assertEquals(["abcd"], /abc./.exec(padding + "abcd"));
+  assertEquals(2000, /abc./.exec(padding + "abcd").index);
+  assertEquals(null, /abc./.exec(padding + "abd"));
+  assertEquals(null, /abc./.exec(padding + "abc"));
+  assertEquals(2000, (twoBytePadding + "abcd").search(/abc./));
+  assertEquals(-1, (twoBytePadding + "abd").search(/abc./));
+  assertEquals(2000, (padding + "☃abc").search(/☃?abc/));
+})();
+
+(function TestCapturesAndGroups() {
+  const m = /(a(?:bc))(d+)/.exec(padding + "abcdd");
+  assertEquals(["abcdd", "abc", "dd"], Array.from(m));
+  assertEquals(2000, m.index);
+  assertEquals(["aaab", "a"], Array.from(/(a)\1{2}b/.exec(padding + "aaab")));
+  assertEquals(["ab"], /a{1,2}b/.exec(padding + "ab"));
+  assertEquals(["b"], /a*b/.exec(padding + "b"));
+})();
+
+(function TestGlobal() {
+  const subject = padding + "foo1" + padding + "foo2" + padding;
+  assertEquals(["foo1", "foo2"], subject.match(/foo\d/g));
+  assertEquals(padding + "bar" + padding + "bar" + padding,
+               subject.replace(/foo\d/g, "bar"));
+  const re = /foo\d/g;
+  assertEquals("foo1", re.exec(subject)[0]);
+  assertEquals(2004, re.lastIndex);
+  assertEquals("foo2", re.exec(subject)[0]);
+  assertEquals(4008, re.lastIndex);
+  assertEquals(null, re.exec(subject));
+  assertEquals(0, re.lastIndex);
+})();
+
+(function TestAssertions() {
+  assertEquals(2001, (padding + "\nabc").search(/^abc/m));
+  assertEquals(-1, (padding + "abc").search(/^abc/));
+  assertEquals(2001, (padding + " abc").search(/\babc/));
+  assertEquals(2005, (padding + "yabcxabc").search(/(?<=x)abc/));
+  assertEquals(2005, (padding + "yabcxabc").search(/abc(?<=xabc)/));
+  assertEquals(2000, (padding + "abcd").search(/abc(?=d)/));
+})();
+
+(function TestFlagsWithoutPrefilter() {
+  assertEquals(2000, (padding + "ABC").search(/abc/i));
+  assertEquals(2000, (padding + "\u{1F600}").search(/\u{1F600}/u));
+  const sticky = /abc/y;
+  sticky.lastIndex = 2000;
+  assertTrue(sticky.test(padding + "abc"));
+  sticky.lastIndex = 1999;
+  assertFalse(sticky.test(padding + "abc"));
+})();
+
+(function TestSplit() {
+  const subject = padding + "--" + padding + "--" + padding;
+  assertEquals([padding, padding, padding], subject.split(/--/));
+})();
@@ -0,0 +1,67 @@
+// Copyright 2021 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+(function TestGlobalStringReplace() {
+  const re = /b+/g;
+  re.lastIndex = 3;
+  assertEquals("aXcXdX", "abcbbdb".replace(re, "X"));
+  assertEquals(0, re.lastIndex);
+  assertEquals("b", RegExp.lastMatch);
+  assertEquals("acd", "abcbbdb".replace(re, ""));
+  assertEquals("abc", "abc".replace(/x/g, "X"));
+  assertEquals("XaXbX", "ab".replace(/(?:)/g, "X"));
+  assertEquals("X\u{1F600}X", "\u{1F600}".replace(/(?:)/gu, "X"));
+  assertEquals("☃X☃X", "☃b☃b".replace(re, "X"));
+  assertEquals("aY", "ab".replace(/b/g, "Y"));
+  assertEquals("a$b", "a-b".replace(/-/g, "$$"));
+})();
+
+(function TestNonGlobalStringReplace() {
+  assertEquals("aXcbbdb", "abcbbdb".replace(/b+/, "X"));
+  assertEquals("acbbdb", "abcbbdb".replace(/b+/, ""));
+  const sticky = /b/y;
+  sticky.lastIndex = 1;
+  assertEquals("aXb", "abb".replace(sticky, "X"));
+  assertEquals(2, sticky.lastIndex);
+  assertEquals("abX", "abb".replace(sticky, "X"));
+  assertEquals(3, sticky.lastIndex);
+  assertEquals("abb", "abb".replace(sticky, "X"));
+  assertEquals(0, sticky.lastIndex);
+})();
+
+(function TestGlobalFunctionReplace() {
+  const calls = [];
+  function record(...args) {
+    calls.push(args);
+    return "<" + args[0] + ">";
+  }
+  assertEquals("<ab>c<ab>", "abcab".replace(/(a)b/g, record));
+  assertEquals([["ab", "a", 0, "abcab"], ["ab", "a", 3, "abcab"]], calls);
+  calls.length = 0;
+  assertEquals("<ab>c<a>", "abca".replace(/(a)(b)?/g, record));
+  assertEquals([["ab", "a", "b", 0, "abca"], ["a", "a", undefined, 3, "abca"]],
+               calls);
+  calls.length = 0;
+  assertEquals("<ab>", "ab".replace(/(?<x>a)b/g, record));
+  assertEquals(1, calls.length);
+  assertEquals(["ab", "a", 0, "ab"], calls[0].slice(0, 4));
+  assertEquals("a", calls[0][4].x);
+  calls.length = 0;
+  assertEquals("<abc>", "abc".replace(/(a)(b)(c)/g, record));
+  assertEquals([["abc", "a", "b", "c", 0, "abc"]], calls);
+})();
+
+(function TestSlowPathReplace() {
+  const re = /b/g;
+  re.exec = function(s) {
+    const result = RegExp.prototype.exec.call(this, s);
+    if (result !== null) result[0] = "bb";
+    return result;
+  };
+  // Matches overlapping a previous replacement are skipped.
+  assertEquals("aXX", "abbbb".replace(re, "X"));
+  assertEquals("aXdX", "abcdbe".replace(re, "X"));
+  assertEquals("a☃X", "a☃bb".replace(re, "X"));
+  assertEquals("ad", "abcdbe".replace(re, ""));
+})();
@@ -0,0 +1,56 @@
+// Copyright 2021 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Case conversion of sliced strings, whose characters start at arbitrary
+// offsets into their parent's, and equality across string representations.
+
+const kParent = "#aBcDeFgHiJkLmNoPqRsTuVwXyZ@[`{0123456789".repeat(4);
+
+function ToLowerSlow(s) {
+  let result = "";
+  for (const c of s) {
+    result += c >= "A" && c <= "Z" ?
+        String.fromCharCode(c.charCodeAt(0) + 32) : c;
+  }
+  return result;
+}
+
+function ToUpperSlow(s) {
+  let result = "";
+  for (const c of s) {
+    result += c >= "a" && c <= "z" ?
+        String.fromCharCode(c.charCodeAt(0) - 32) : c;
+  }
+  return result;
+}
+
+(function TestSlicedStrings() {
+  for (let start = 0; start < 9; start++) {
+    for (let length = 0; start + length <= kParent.length; length += 7) {
+      const s = kParent.substring(start, start + length);
+      assertEquals(ToLowerSlow(s), s.toLowerCase());
+      assertEquals(ToUpperSlow(s), s.toUpperCase());
+    }
+  }
+})();
+
+(function TestNonAsciiAfterAsciiPrefix() {
+  const s = kParent.substring(3) + "É";
+  assertEquals(ToLowerSlow(kParent.substring(3)) + "é", s.toLowerCase());
+  assertEquals("SS", "ß".toUpperCase());
+})();
+
+(function TestEqualsAcrossRepresentations() {
+  for (let length = 1; length < 100; length += 13) {
+    const one_byte = kParent.substring(1, 1 + length);
+    const two_byte = ("☃" + one_byte).substring(1);
+    assertTrue(one_byte == two_byte);
+    for (let i = 0; i < length; i++) {
+      const different = two_byte.substring(0, i) + "!" +
+                        two_byte.substring(i + 1);
+      assertFalse(one_byte == different);
+      assertFalse(different == one_byte);
+    }
+  }
+})();
@@ -0,0 +1,55 @@
+// Copyright 2021 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Patterns whose first character is common in the subject are searched for by
+// filtering on their first and last characters.
+
+function NaiveIndexOf(subject, pattern, start) {
+  outer: for (let i = start; i <= subject.length - pattern.length; i++) {
+    for (let j = 0; j < pattern.length; j++) {
+      if (subject[j + i] !== pattern[j]) continue outer;
+    }
+    return i;
+  }
+  return -1;
+}
+
+function CreateSubject(alphabet, length) {
+  let s = "";
+  for (let i = 0; i < length; i++) {
+    s += alphabet[Math.floor(Math.random() * alphabet.length)];
+  }
+  return s;
+}
+
+function TestAlphabet(alphabet) {
+  const subject = CreateSubject(alphabet, 300);
+  for (let length = 2; length <= 12; length++) {
+    for (let start = 0; start < subject.length; start += 37) {
+      const present = subject.substring(start, start + length);
+      const absent = present.substring(0, length - 1) + "z";
+      for (const pattern of [present, absent]) {
+        for (const from of [0, 1, 50, 299]) {
+          assertEquals(NaiveIndexOf(subject, pattern, from),
+                       subject.indexOf(pattern, from), pattern);
+        }
+        assertEquals(NaiveIndexOf(subject, pattern, 0) != -1,
+                     subject.includes(pattern));
+      }
+    }
+  }
+}
+
+TestAlphabet("ab");
+TestAlphabet("abcd");
+TestAlphabet("a☃");
+TestAlphabet("☃☄★");
+
+(function TestSplitAndReplace() {
+  const subject = "aab".repeat(100) + "aac";
+  assertEquals(101, subject.split("ab").length);
+  assertEquals("X".repeat(100) + "aac", subject.replaceAll("aab", "X"));
+  assertEquals(300, subject.indexOf("aac"));
+  assertEquals(300, (subject + "☃").indexOf("aac"));
+})();
@@ -0,0 +1,68 @@
+// Copyright 2021 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --wasm-huge-pages --experimental-wasm-threads
+
+// Smoke test: memories whose reservations are advised to use huge pages must
+// behave like any other memory. Whether the OS actually backs them with huge
+// pages is not observable from JavaScript.
+
+load("test/mjsunit/wasm/wasm-module-builder.js");
+
+function instantiate(initial, maximum, shared) {
+  const builder = new WasmModuleBuilder();
+  builder.addMemory(initial, maximum, true, shared);
+  builder.addFunction("load", kSig_i_i)
+      .addBody([kExprLocalGet, 0, kExprI32LoadMem, 0, 0])
+      .exportFunc();
+  builder.addFunction("store", kSig_v_ii)
+      .addBody([kExprLocalGet, 0, kExprLocalGet, 1, kExprI32StoreMem, 0, 0])
+      .exportFunc();
+  builder.addFunction("grow", kSig_i_i)
+      .addBody([kExprLocalGet, 0, kExprMemoryGrow, kMemoryZero])
+      .exportFunc();
+  return builder.instantiate();
+}
+
+function testGrowInPlace(shared) {
+  const instance = instantiate(1, 100, shared);
+  const kPages = 40;  // More than a huge page.
+  for (let page = 1; page < kPages; page++) {
+    assertEquals(page, instance.exports.grow(1));
+  }
+  for (let page = 0; page < kPages; page++) {
+    const offset = page * kPageSize;
+    assertEquals(0, instance.exports.load(offset));
+    instance.exports.store(offset, page + 1);
+  }
+  for (let page = 0; page < kPages; page++) {
+    assertEquals(page + 1, instance.exports.load(page * kPageSize));
+  }
+  assertTraps(kTrapMemOutOfBounds,
+              () => instance.exports.load(kPages * kPageSize));
+  const view = new Int32Array(instance.exports.memory.buffer);
+  assertEquals(kPages, view[(kPages - 1) * kPageSize / 4]);
+}
+
+(function TestGrowInPlace() {
+  print(arguments.callee.name);
+  testGrowInPlace(false);
+})();
+
+(function TestGrowInPlaceShared() {
+  print(arguments.callee.name);
+  testGrowInPlace(true);
+})();
+
+(function TestGrowFromJS() {
+  print(arguments.callee.name);
+  const memory = new WebAssembly.Memory({initial: 1, maximum: 64});
+  const view = new Uint8Array(memory.buffer);
+  view[100] = 42;
+  assertEquals(1, memory.grow(63));
+  const grown = new Uint8Array(memory.buffer);
+  assertEquals(64 * kPageSize, grown.length);
+  assertEquals(42, grown[100]);
+  assertEquals(0, grown[grown.length - 1]);
+})();
@@ -0,0 +1,162 @@
+// Copyright 2021 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --wasm-inlining --no-liftoff --experimental-wasm-mv
+// Flags: --experimental-wasm-return-call
+
+load("test/mjsunit/wasm/wasm-module-builder.js");
+
+(function SimpleInlining() {
+  print(arguments.callee.name);
+  let builder = new WasmModuleBuilder();
+  let callee = builder.addFunction("callee", kSig_i_ii)
+      .addBody([kExprLocalGet, 0, kExprLocalGet, 1, kExprI32Add]);
+  builder.addFunction("main", kSig_i_i)
+      .addBody([kExprLocalGet, 0, kExprI32Const, 1,
+                kExprCallFunction, callee.index])
+      .exportFunc();
+  let instance = builder.instantiate();
+  assertEquals(14, instance.exports.main(13));
+})();
+
+(function NestedInlining() {
+  print(arguments.callee.name);
+  let builder = new WasmModuleBuilder();
+  let inner = builder.addFunction("inner", kSig_i_i)
+      .addBody([kExprLocalGet, 0, kExprI32Const, 2, kExprI32Mul]);
+  let outer = builder.addFunction("outer", kSig_i_i)
+      .addBody([kExprLocalGet, 0, kExprCallFunction, inner.index,
+                kExprI32Const, 1, kExprI32Add]);
+  builder.addFunction("main", kSig_i_i)
+      .addBody([kExprLocalGet, 0, kExprCallFunction, outer.index])
+      .exportFunc();
+  let instance = builder.instantiate();
+  assertEquals(11, instance.exports.main(5));
+})();
+
+(function VoidCalleeWithSideEffects() {
+  print(arguments.callee.name);
+  let builder = new WasmModuleBuilder();
+  let global = builder.addGlobal(kWasmI32, true);
+  let callee = builder.addFunction("callee", kSig_v_i)
+      .addBody([kExprGlobalGet, global.index, kExprLocalGet, 0, kExprI32Add,
+                kExprGlobalSet, global.index]);
+  builder.addFunction("main", kSig_i_i)
+      .addBody([kExprLocalGet, 0, kExprCallFunction, callee.index,
+                kExprLocalGet, 0, kExprCallFunction, callee.index,
+                kExprGlobalGet, global.index])
+      .exportFunc();
+  let instance = builder.instantiate();
+  assertEquals(8, instance.exports.main(4));
+  assertEquals(20, instance.exports.main(6));
+})();
+
+(function MultiReturnCallee() {
+  print(arguments.callee.name);
+  let builder = new WasmModuleBuilder();
+  let callee = builder.addFunction("callee", kSig_ii_i)
+      .addBody([kExprLocalGet, 0, kExprI32Const, 1, kExprI32Add,
+                kExprLocalGet, 0, kExprI32Const, 1, kExprI32Sub]);
+  builder.addFunction("main", kSig_i_i)
+      .addBody([kExprLocalGet, 0, kExprCallFunction, callee.index,
+                kExprI32Mul])
+      .exportFunc();
+  let instance = builder.instantiate();
+  assertEquals(48, instance.exports.main(7));
+})();
+
+(function CalleeWithMultipleReturns() {
+  print(arguments.callee.name);
+  let builder = new WasmModuleBuilder();
+  let callee = builder.addFunction("callee", kSig_i_i)
+      .addBody([kExprLocalGet, 0,
+                kExprIf, kWasmI32,
+                  kExprI32Const, 10,
+                  kExprReturn,
+                kExprElse,
+                  kExprI32Const, 20,
+                kExprEnd]);
+  builder.addFunction("main", kSig_i_i)
+      .addBody([kExprLocalGet, 0, kExprCallFunction, callee.index,
+                kExprI32Const, 1, kExprI32Add])
+      .exportFunc();
+  let instance = builder.instantiate();
+  assertEquals(11, instance.exports.main(1));
+  assertEquals(21, instance.exports.main(0));
+})();
+
+(function TrapInInlinee() {
+  print(arguments.callee.name);
+  let builder = new WasmModuleBuilder();
+  let div = builder.addFunction("div", kSig_i_ii)
+      .addBody([kExprLocalGet, 0, kExprLocalGet, 1, kExprI32DivS]);
+  let crash = builder.addFunction("crash", kSig_i_v)
+      .addBody([kExprUnreachable]);
+  builder.addFunction("main", kSig_i_ii)
+      .addBody([kExprLocalGet, 0, kExprLocalGet, 1,
+                kExprCallFunction, div.index])
+      .exportFunc();
+  builder.addFunction("main_unreachable", kSig_i_i)
+      .addBody([kExprLocalGet, 0,
+                kExprIf, kWasmI32,
+                  kExprCallFunction, crash.index,
+                kExprElse,
+                  kExprI32Const, 3,
+                kExprEnd])
+      .exportFunc();
+  let instance = builder.instantiate();
+  assertEquals(3, instance.exports.main(7, 2));
+  assertTraps(kTrapDivByZero, () => instance.exports.main(7, 0));
+  assertEquals(3, instance.exports.main_unreachable(0));
+  assertTraps(kTrapUnreachable, () => instance.exports.main_unreachable(1));
+})();
+
+(function RecursiveCalleeIsNotInlinedIntoItself() {
+  print(arguments.callee.name);
+  let builder = new WasmModuleBuilder();
+  let fact = builder.addFunction("fact", kSig_i_i);
+  fact.addBody([kExprLocalGet, 0,
+                kExprI32Eqz,
+                kExprIf, kWasmI32,
+                  kExprI32Const, 1,
+                kExprElse,
+                  kExprLocalGet, 0,
+                  kExprLocalGet, 0, kExprI32Const, 1, kExprI32Sub,
+                  kExprCallFunction, fact.index,
+                  kExprI32Mul,
+                kExprEnd]);
+  builder.addFunction("main", kSig_i_i)
+      .addBody([kExprLocalGet, 0, kExprCallFunction, fact.index])
+      .exportFunc();
+  let instance = builder.instantiate();
+  assertEquals(120, instance.exports.main(5));
+})();
+
+(function CalleeWithTailCallIsNotInlined() {
+  print(arguments.callee.name);
+  let builder = new WasmModuleBuilder();
+  let sig_i_i = builder.addType(kSig_i_i);
+  let double = builder.addFunction("double", kSig_i_i)
+      .addBody([kExprLocalGet, 0, kExprLocalGet, 0, kExprI32Add]);
+  let tail_direct = builder.addFunction("tail_direct", kSig_i_i)
+      .addBody([kExprLocalGet, 0, kExprI32Const, 1, kExprI32Add,
+                kExprReturnCall, double.index]);
+  let tail_indirect = builder.addFunction("tail_indirect", kSig_i_i)
+      .addBody([kExprLocalGet, 0, kExprI32Const, 1, kExprI32Add,
+                kExprI32Const, 0,
+                kExprReturnCallIndirect, sig_i_i, kTableZero]);
+  builder.appendToTable([double.index]);
+  // The callers do more work after the calls, which must not be skipped.
+  builder.addFunction("main_direct", kSig_i_i)
+      .addBody([kExprLocalGet, 0, kExprCallFunction, tail_direct.index,
+                kExprI32Const, 100, kExprI32Add])
+      .exportFunc();
+  builder.addFunction("main_indirect", kSig_i_i)
+      .addBody([kExprLocalGet, 0, kExprCallFunction, tail_indirect.index,
+                kExprI32Const, 100, kExprI32Add])
+      .exportFunc();
+  let instance = builder.instantiate();
+  assertEquals(112, instance.exports.main_direct(5));
+  assertEquals(112, instance.exports.main_indirect(5));
+})();
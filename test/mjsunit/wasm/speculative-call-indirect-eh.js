@@ -0,0 +1,55 @@
+// Copyright 2021 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --wasm-speculative-call-indirect --no-liftoff --experimental-wasm-eh
+
+load("test/mjsunit/wasm/wasm-module-builder.js");
+load("test/mjsunit/wasm/exceptions-utils.js");
+
+// Call sites inside try blocks are not speculated on, the ones outside of
+// them still are, with exception handling enabled.
+(function TestSpeculationWithExceptionHandling() {
+  print(arguments.callee.name);
+  const builder = new WasmModuleBuilder();
+  const except = builder.addException(kSig_v_v);
+  const sig_i_i = builder.addType(kSig_i_i);
+  // {thrower} is the only function of signature i_i in the table.
+  const thrower = builder.addFunction("thrower", sig_i_i)
+      .addBody([
+        kExprLocalGet, 0,
+        kExprI32Eqz,
+        kExprIf, kWasmStmt,
+          kExprThrow, except,
+        kExprEnd,
+        kExprLocalGet, 0,
+        kExprI32Const, 1,
+        kExprI32Add
+      ]);
+  builder.addFunction("call_caught", kSig_i_ii)
+      .addBody([
+        kExprTry, kWasmI32,
+          kExprLocalGet, 1,                     // argument
+          kExprLocalGet, 0,                     // table index
+          kExprCallIndirect, sig_i_i, kTableZero,
+        kExprCatch, except,
+          kExprI32Const, 23,
+        kExprEnd
+      ])
+      .exportFunc();
+  builder.addFunction("call_uncaught", kSig_i_ii)
+      .addBody([
+        kExprLocalGet, 1,                       // argument
+        kExprLocalGet, 0,                       // table index
+        kExprCallIndirect, sig_i_i, kTableZero
+      ])
+      .exportFunc();
+  builder.appendToTable([thrower.index]);
+  const instance = builder.instantiate();
+
+  assertEquals(6, instance.exports.call_caught(0, 5));
+  assertEquals(23, instance.exports.call_caught(0, 0));
+  assertEquals(6, instance.exports.call_uncaught(0, 5));
+  assertWasmThrows(instance, except, [],
+                   () => instance.exports.call_uncaught(0, 0));
+})();
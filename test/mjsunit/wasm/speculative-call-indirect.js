@@ -0,0 +1,74 @@
+// Copyright 2021 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --wasm-speculative-call-indirect --no-liftoff
+
+load("test/mjsunit/wasm/wasm-module-builder.js");
+
+function createModule() {
+  const builder = new WasmModuleBuilder();
+  const sig_i_i = builder.addType(kSig_i_i);
+  const sig_v_v = builder.addType(kSig_v_v);
+  const base = builder.addImportedGlobal("m", "base", kWasmI32);
+  // {get} is the only function of signature i_i in the table, so call sites
+  // of that signature speculate on it.
+  const get = builder.addFunction("get", sig_i_i)
+      .addBody([kExprLocalGet, 0, kExprGlobalGet, base, kExprI32Add])
+      .exportFunc();
+  const nop = builder.addFunction("nop", sig_v_v).addBody([]).exportFunc();
+  builder.addFunction("other", sig_i_i)
+      .addBody([kExprLocalGet, 0, kExprI32Const, 100, kExprI32Mul])
+      .exportFunc();
+  builder.addFunction("call", kSig_i_ii)
+      .addBody([
+        kExprLocalGet, 1,                     // argument
+        kExprLocalGet, 0,                     // table index
+        kExprCallIndirect, sig_i_i, kTableZero
+      ])
+      .exportFunc();
+  builder.appendToTable([get.index, nop.index, get.index]);
+  builder.addExportOfKind("table", kExternalTable, 0);
+  return builder.toModule();
+}
+
+const module = createModule();
+const instance1 = new WebAssembly.Instance(module, {m: {base: 10}});
+const instance2 = new WebAssembly.Instance(module, {m: {base: 20}});
+
+(function TestPredictedTarget() {
+  print(arguments.callee.name);
+  assertEquals(15, instance1.exports.call(0, 5));
+  assertEquals(17, instance1.exports.call(2, 7));
+  assertEquals(25, instance2.exports.call(0, 5));
+})();
+
+(function TestSignatureMismatchStillTraps() {
+  print(arguments.callee.name);
+  assertTraps(kTrapFuncSigMismatch, () => instance1.exports.call(1, 5));
+  assertTraps(kTrapTableOutOfBounds, () => instance1.exports.call(3, 5));
+})();
+
+(function TestPredictedFunctionOfOtherInstance() {
+  print(arguments.callee.name);
+  // Same jump table slot, but the callee must run in {instance2}.
+  instance1.exports.table.set(0, instance2.exports.get);
+  assertEquals(25, instance1.exports.call(0, 5));
+  instance1.exports.table.set(0, instance1.exports.get);
+  assertEquals(15, instance1.exports.call(0, 5));
+})();
+
+(function TestMispredictedTarget() {
+  print(arguments.callee.name);
+  instance1.exports.table.set(2, instance1.exports.other);
+  assertEquals(700, instance1.exports.call(2, 7));
+  assertEquals(15, instance1.exports.call(0, 5));
+
+  const builder = new WasmModuleBuilder();
+  builder.addFunction("neg", kSig_i_i)
+      .addBody([kExprI32Const, 0, kExprLocalGet, 0, kExprI32Sub])
+      .exportFunc();
+  const foreign = builder.instantiate();
+  instance1.exports.table.set(2, foreign.exports.neg);
+  assertEquals(-7, instance1.exports.call(2, 7));
+})();
@@ -0,0 +1,101 @@
+// Copyright 2021 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/parsing/parallel-preparser.h"
+
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "testing/gtest/include/gtest/gtest.h"
+
+namespace v8 {
+namespace internal {
+
+namespace {
+
+using FunctionStart = ParallelPreparser::FunctionStart;
+
+std::vector<FunctionStart> FindFunctions(const char* source,
+                                         LanguageMode* language_mode) {
+  *language_mode = LanguageMode::kSloppy;
+  return ParallelPreparser::FindTopLevelFunctions(
+      reinterpret_cast<const uint8_t*>(source),
+      static_cast<int>(strlen(source)), language_mode);
+}
+
+// Returns the positions of the parameter lists of the functions that are
+// expected to be found, marked by '@' in {source}, and removes the markers.
+std::vector<int> ExpectedPositions(std::string* source) {
+  std::vector<int> positions;
+  size_t marker;
+  while ((marker = source->find('@')) != std::string::npos) {
+    source->erase(marker, 1);
+    positions.push_back(static_cast<int>(source->find('(', marker)));
+  }
+  return positions;
+}
+
+void CheckFunctions(const char* marked_source) {
+  std::string source(marked_source);
+  std::vector<int> expected = ExpectedPositions(&source);
+  LanguageMode language_mode;
+  std::vector<FunctionStart> functions =
+      FindFunctions(source.c_str(), &language_mode);
+  ASSERT_EQ(expected.size(), functions.size()) << source;
+  for (size_t i = 0; i < expected.size(); i++) {
+    EXPECT_EQ(expected[i], functions[i].position) << source;
+  }
+}
+
+}  // namespace
+
+TEST(ParallelPreparserTest, FindsTopLevelFunctions) {
+  CheckFunctions("@function f(a) { function g() {} } @function h() {}");
+  CheckFunctions("var f = @function() {}; var g = @function named() {};");
+  CheckFunctions("if (x) { function f() {} } (function() {})();");
+  CheckFunctions("var o = { function() {} }; o.function(1);");
+  CheckFunctions("x = a\n@function f() {}");
+  CheckFunctions("a = b / 2 / @function f() {};");
+}
+
+TEST(ParallelPreparserTest, SkipsLiteralsAndComments) {
+  CheckFunctions("// function f() {\n@function g() {}");
+  CheckFunctions("/* { function f() { */ @function g() {}");
+  CheckFunctions("'function f() {'; \"{\\\"\"; @function g() {}");
+  CheckFunctions("`${ function f() {} }{`; @function g() {}");
+  CheckFunctions("`${ `${ '}' }` }`; @function g() {}");
+  CheckFunctions("x = /{[/]function f() {}/g; @function g() {}");
+  CheckFunctions("return /}/.test(s); @function g() {}");
+  CheckFunctions("let n = 1.5e3; @function g() {}");
+}
+
+TEST(ParallelPreparserTest, FunctionKinds) {
+  LanguageMode language_mode;
+  std::vector<FunctionStart> functions = FindFunctions(
+      "function f() {} function* g() {} async function h() {}"
+      "async function* i() {} async\nfunction j() {}",
+      &language_mode);
+  ASSERT_EQ(5u, functions.size());
+  EXPECT_EQ(FunctionKind::kNormalFunction, functions[0].kind);
+  EXPECT_EQ(FunctionKind::kGeneratorFunction, functions[1].kind);
+  EXPECT_EQ(FunctionKind::kAsyncFunction, functions[2].kind);
+  EXPECT_EQ(FunctionKind::kAsyncGeneratorFunction, functions[3].kind);
+  EXPECT_EQ(FunctionKind::kNormalFunction, functions[4].kind);
+}
+
+TEST(ParallelPreparserTest, UseStrictDirective) {
+  LanguageMode language_mode;
+  FindFunctions("// Comment\n'use strict'; function f() {}", &language_mode);
+  EXPECT_EQ(LanguageMode::kStrict, language_mode);
+  FindFunctions("'other'\n\"use strict\"\nfunction f() {}", &language_mode);
+  EXPECT_EQ(LanguageMode::kStrict, language_mode);
+  FindFunctions("'use strict' + x; function f() {}", &language_mode);
+  EXPECT_EQ(LanguageMode::kSloppy, language_mode);
+  FindFunctions("x; 'use strict'; function f() {}", &language_mode);
+  EXPECT_EQ(LanguageMode::kSloppy, language_mode);
+}
+
+}  // namespace internal
+}  // namespace v8
@@ -0,0 +1,210 @@
+// Copyright 2021 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/parsing/scanner-word-scan.h"
+
+#include <algorithm>
+#include <limits>
+#include <vector>
+
+#include "src/base/utils/random-number-generator.h"
+#include "src/strings/char-predicates-inl.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+namespace v8 {
+namespace internal {
+
+namespace {
+
+// Per-unit reference versions of what the ScanWords finders stop at.
+
+bool IsIdentifierPartReference(uc32 c) {
+  return ('a' <= c && c <= 'z') || ('A' <= c && c <= 'Z') ||
+         ('0' <= c && c <= '9') || c == '_' || c == '$';
+}
+
+bool IsLineTerminatorReference(uc32 c) {
+  return c == '\n' || c == '\r' || c == 0x2028 || c == 0x2029;
+}
+
+// Code units next to the boundaries of the word checks. Among them are the
+// boundaries of the letter ranges after folding with 0x20 ('@', '[', '`',
+// '{'), non-ASCII units whose low 7 bits are interesting ASCII units ('*',
+// '\n', 'a', ' ' ored with 0x80 or 0x100), and the first and last units the
+// non-ASCII flag has to catch.
+const uint16_t kInterestingUnits[] = {
+    0x00,   0x08,   '\t',   '\n',   '\v',   '\f',   '\r',   0x0E,   0x1F,
+    ' ',    '!',    '$',    '%',    '*',    '+',    '/',    '0',    '9',
+    ':',    '@',    'A',    'Z',    '[',    '_',    '`',    'a',    'z',
+    '{',    0x7F,   0x80,   0x8A,   0xA0,   0xAA,   0xC1,   0xE1,   0xFF,
+    0x100,  0x10A,  0x120,  0x12A,  0x161,  0x1680, 0x2028, 0x2029, 0x202A,
+    0x7F80, 0x7FFF, 0x8000, 0xFEFF, 0xFFFF};
+
+template <typename Char>
+std::vector<Char> InterestingUnits() {
+  std::vector<Char> units;
+  for (uint16_t unit : kInterestingUnits) {
+    if (unit <= std::numeric_limits<Char>::max()) units.push_back(unit);
+  }
+  return units;
+}
+
+// Checks all finders against the reference on every range [start, end) of
+// {units}, so that every unit is looked at through every position in a word,
+// both in full words and in the units after the last full word.
+template <typename Char>
+void CheckFinders(const std::vector<Char>& units) {
+  const Char* data = units.data();
+  const size_t size = units.size();
+  for (size_t start = 0; start <= size; start++) {
+    for (size_t end = start; end <= size; end++) {
+      const Char* begin = data + start;
+      const Char* limit = data + end;
+      auto expect = [=](const Char* found, auto stops, const char* name) {
+        const Char* expected = std::find_if(begin, limit, stops);
+        EXPECT_EQ(expected - data, found - data)
+            << name << " on [" << start << ", " << end << ")";
+      };
+      expect(ScanWords::FindNonAsciiIdentifierPart(begin, limit),
+             [](Char c) { return !IsIdentifierPartReference(c); },
+             "FindNonAsciiIdentifierPart");
+      expect(ScanWords::FindNonWhiteSpace(begin, limit),
+             [](Char c) { return !IsWhiteSpaceOrLineTerminator(c); },
+             "FindNonWhiteSpace");
+      expect(ScanWords::FindLineTerminator(begin, limit),
+             [](Char c) { return IsLineTerminatorReference(c); },
+             "FindLineTerminator");
+      expect(ScanWords::FindStarOrLineTerminator(begin, limit),
+             [](Char c) { return c == '*' || IsLineTerminatorReference(c); },
+             "FindStarOrLineTerminator");
+      expect(ScanWords::FindStar(begin, limit),
+             [](Char c) { return c == '*'; }, "FindStar");
+    }
+  }
+}
+
+template <typename Char>
+void TestRunsOfEveryLength() {
+  // Runs of units that all finders but one skip, followed by each of the
+  // interesting units. Every run length up to three words, and with that
+  // every position of the last unit relative to a word and to the end of the
+  // buffer, is covered by the ranges CheckFinders tries.
+  const size_t kRunLength = 3 * sizeof(uintptr_t);
+  const Char runs[] = {'a', 'Z', '_', '$', '5', ' ', '\t', 'x'};
+  for (Char run : runs) {
+    for (Char unit : InterestingUnits<Char>()) {
+      std::vector<Char> units(kRunLength, run);
+      units.push_back(unit);
+      CheckFinders(units);
+    }
+  }
+}
+
+template <typename Char>
+void TestRandomUnits() {
+  const std::vector<Char> interesting = InterestingUnits<Char>();
+  const int interesting_count = static_cast<int>(interesting.size());
+  base::RandomNumberGenerator rng(::testing::FLAGS_gtest_random_seed);
+  for (int i = 0; i < 200; i++) {
+    std::vector<Char> units(rng.NextInt(4 * sizeof(uintptr_t)));
+    // Mostly runs of a single unit, which the word checks skip, with some
+    // interesting and arbitrary units mixed in.
+    Char run = interesting[rng.NextInt(interesting_count)];
+    for (Char& unit : units) {
+      switch (rng.NextInt(4)) {
+        case 0:
+          unit = interesting[rng.NextInt(interesting_count)];
+          break;
+        case 1:
+          unit = static_cast<Char>(rng.NextInt(
+              static_cast<int>(std::numeric_limits<Char>::max()) + 1));
+          break;
+        default:
+          unit = run;
+          break;
+      }
+    }
+    CheckFinders(units);
+  }
+}
+
+template <typename Char>
+void TestAllUnits() {
+  // Every code unit, in the middle of the second word of a run that the
+  // finder skips.
+  const size_t kPerWord = sizeof(uintptr_t) / sizeof(Char);
+  std::vector<Char> units(3 * kPerWord);
+  const Char* begin = units.data();
+  const Char* end = begin + units.size();
+  const Char* at = begin + kPerWord + 1;
+  for (uint32_t unit = 0; unit <= std::numeric_limits<Char>::max(); unit++) {
+    std::fill(units.begin(), units.end(), 'a');
+    units[at - begin] = static_cast<Char>(unit);
+    EXPECT_EQ(IsIdentifierPartReference(unit) ? end : at,
+              ScanWords::FindNonAsciiIdentifierPart(begin, end))
+        << unit;
+    EXPECT_EQ(unit == '*' ? at : end, ScanWords::FindStar(begin, end))
+        << unit;
+    EXPECT_EQ(unit == '*' || IsLineTerminatorReference(unit) ? at : end,
+              ScanWords::FindStarOrLineTerminator(begin, end))
+        << unit;
+    EXPECT_EQ(IsLineTerminatorReference(unit) ? at : end,
+              ScanWords::FindLineTerminator(begin, end))
+        << unit;
+    std::fill(units.begin(), units.end(), ' ');
+    units[at - begin] = static_cast<Char>(unit);
+    EXPECT_EQ(IsWhiteSpaceOrLineTerminator(unit) ? end : at,
+              ScanWords::FindNonWhiteSpace(begin, end))
+        << unit;
+  }
+}
+
+}  // namespace
+
+TEST(ScanWordsTest, RunsOfEveryLengthOneByte) {
+  TestRunsOfEveryLength<uint8_t>();
+}
+
+TEST(ScanWordsTest, RunsOfEveryLengthTwoByte) {
+  TestRunsOfEveryLength<uint16_t>();
+}
+
+TEST(ScanWordsTest, RandomUnitsOneByte) { TestRandomUnits<uint8_t>(); }
+
+TEST(ScanWordsTest, RandomUnitsTwoByte) { TestRandomUnits<uint16_t>(); }
+
+TEST(ScanWordsTest, AllUnitsOneByte) { TestAllUnits<uint8_t>(); }
+
+TEST(ScanWordsTest, AllUnitsTwoByte) { TestAllUnits<uint16_t>(); }
+
+TEST(ScanWordsTest, NonAsciiWhiteSpace) {
+  // U+00A0 and U+2028 are skipped as whitespace even within a word, and only
+  // U+2028 terminates a line.
+  const uint16_t units[] = {' ', 0xA0, ' ', 0x2028, ' ', ' ', ' ', ' ', 'x'};
+  const uint16_t* end = units + arraysize(units);
+  EXPECT_EQ(end - 1, ScanWords::FindNonWhiteSpace(units, end));
+  EXPECT_EQ(units + 3, ScanWords::FindLineTerminator(units, end));
+  const uint8_t one_byte_units[] = {' ', 0xA0, ' ', ' ', ' ', ' ', ' ',
+                                    ' ', ' ', 0xA0, 'x'};
+  const uint8_t* one_byte_end = one_byte_units + arraysize(one_byte_units);
+  EXPECT_EQ(one_byte_end - 1,
+            ScanWords::FindNonWhiteSpace(one_byte_units, one_byte_end));
+  EXPECT_EQ(one_byte_end,
+            ScanWords::FindLineTerminator(one_byte_units, one_byte_end));
+}
+
+TEST(ScanWordsTest, FindStarSkipsNonAsciiLookalikes) {
+  // 0xAA and U+012A have the same low 7 bits as '*'.
+  const uint16_t units[] = {0xAA, 0x12A, 0x7FAA, 0xAA, 0x12A, 0xAA, 0x2A};
+  const uint16_t* end = units + arraysize(units);
+  EXPECT_EQ(end - 1, ScanWords::FindStar(units, end));
+  const uint8_t one_byte_units[] = {0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+                                    0xAA, 0xAA, 0xAA, 0xAA, 0x2A};
+  const uint8_t* one_byte_end = one_byte_units + arraysize(one_byte_units);
+  EXPECT_EQ(one_byte_end - 1,
+            ScanWords::FindStar(one_byte_units, one_byte_end));
+}
+
+}  // namespace internal
+}  // namespace v8
@@ -2,10 +2,12 @@
 // Use of this source code is governed by a BSD-style license that can be
 // found in the LICENSE file.
 
+#include <algorithm>
 #include <memory>
 #include <string>
 #include <vector>
 
+#include "src/base/utils/random-number-generator.h"
 #include "src/strings/unicode-decoder.h"
 #include "src/strings/unicode-inl.h"
 #include "src/utils/vector.h"
@@ -493,5 +495,58 @@ TEST(UnicodeTest, IncrementalUTF8DecodingVsNonIncrementalUtf8Decoding) {
   }
 }
 
+TEST(UnicodeTest, Utf8DecoderFastPathsVsIncrementalDecoding) {
+  // The decoder skips ASCII runs a word at a time and decodes well-formed
+  // two- and three-byte sequences directly. Mix those with sequences that
+  // take the slow path, in inputs long enough to span several words.
+  const std::vector<byte> pieces[] = {
+      {'a'},
+      {'x', 'y', 'z', '0', '1', '2', '3', '4', '5', '6', '7', '8', '9'},
+      {0xC2, 0x80},              // U+0080
+      {0xC3, 0xA9},              // U+00E9
+      {0xDF, 0xBF},              // U+07FF
+      {0xE0, 0xA0, 0x80},        // U+0800
+      {0xE4, 0xB8, 0xAD},        // U+4E2D
+      {0xED, 0x9F, 0xBF},        // U+D7FF
+      {0xEF, 0xBF, 0xBF},        // U+FFFF
+      {0xF0, 0x9F, 0x98, 0x80},  // U+1F600
+      {0xC0, 0x80},              // Overlong.
+      {0xE0, 0x80, 0x80},        // Overlong.
+      {0xED, 0xA0, 0x80},        // Surrogate.
+      {0xE4, 0xB8},              // Truncated.
+      {0x80},                    // Stray continuation byte.
+      {0xFF},
+  };
+  base::RandomNumberGenerator rng(::testing::FLAGS_gtest_random_seed);
+  for (int i = 0; i < 1000; i++) {
+    std::vector<byte> bytes;
+    int count = rng.NextInt(40);
+    for (int j = 0; j < count; j++) {
+      const std::vector<byte>& piece = pieces[rng.NextInt(arraysize(pieces))];
+      bytes.insert(bytes.end(), piece.begin(), piece.end());
+    }
+
+    std::vector<unibrow::uchar> output_incremental;
+    DecodeIncrementally(bytes, &output_incremental);
+    std::vector<unibrow::uchar> output_utf16;
+    DecodeUtf16(bytes, &output_utf16);
+    CHECK(output_utf16 == output_incremental);
+
+    bool is_one_byte = true;
+    for (unibrow::uchar c : output_incremental) {
+      if (c > unibrow::Latin1::kMaxChar) is_one_byte = false;
+    }
+    auto utf8_data = Vector<const uint8_t>::cast(VectorOf(bytes));
+    Utf8Decoder decoder(utf8_data);
+    CHECK_EQ(is_one_byte, decoder.is_one_byte());
+    if (is_one_byte) {
+      std::vector<uint8_t> latin1(decoder.utf16_length());
+      decoder.Decode(latin1.data(), utf8_data);
+      CHECK(std::equal(latin1.begin(), latin1.end(),
+                       output_incremental.begin()));
+    }
+  }
+}
+
 }  // namespace internal
 }  // namespace v8
@@ -22,5 +22,27 @@ TEST(Zone, 8ByteAlignment) {
   }
 }
 
+TEST(Zone, ReusesPooledSegments) {
+  AccountingAllocator allocator;
+  {
+    Zone zone(&allocator, ZONE_NAME);
+    for (int i = 0; i < 8; ++i) zone.Allocate<ZoneTest>(4 * KB);
+    EXPECT_LT(0u, allocator.GetCurrentMemoryUsage());
+  }
+  // The segments of the destroyed zone are kept for the next zones.
+  EXPECT_EQ(0u, allocator.GetCurrentMemoryUsage());
+  size_t pool_size = allocator.GetCurrentPoolSize();
+  EXPECT_LT(0u, pool_size);
+  {
+    Zone zone(&allocator, ZONE_NAME);
+    zone.Allocate<ZoneTest>(4 * KB);
+    EXPECT_GT(pool_size, allocator.GetCurrentPoolSize());
+  }
+  EXPECT_EQ(pool_size, allocator.GetCurrentPoolSize());
+
+  allocator.ReleasePooledSegments();
+  EXPECT_EQ(0u, allocator.GetCurrentPoolSize());
+}
+
 }  // namespace internal
 }  // namespace v8
@@ -7,7 +7,13 @@
 python %prog trace-file
 
 Parses output generated by v8 with flag --trace-regexp-bytecodes and generates
-a list of the most common sequences.
+a list of the number of dispatches per bytecode, and of the most common
+sequences. Candidates for new fused bytecodes in
+src/regexp/regexp-bytecode-peephole.cc are found this way, e.g. by running the
+RegExp benchmarks in a debug build:
+
+  cd test/js-perf-test/RegExp
+  d8 --regexp-interpret-all --trace-regexp-bytecodes run.js > trace-file
 """
 
 from __future__ import print_function
@@ -54,9 +60,17 @@ def print_most_common(d, seqlen, total):
       return
     print("{}: {} ({} %)".format(k,v,(v*100/total)))
 
+def print_dispatch_counts(d, total):
+  sorted_d = sorted(d.items(), key=lambda kv: kv[1], reverse=True)
+  for (k,v) in sorted_d:
+    print("{}: {} ({} %)".format(k,v,(v*100/total)))
+
 def main(argv):
   max_seq = 7
   bc_cnt, total = parse(argv[1],max_seq)
+  print("Dispatches per bytecode ({} total)".format(total))
+  print()
+  print_dispatch_counts(bc_cnt[0], total)
   for i in range(max_seq):
     print()
     print("Most common of length {}".format(i+1))